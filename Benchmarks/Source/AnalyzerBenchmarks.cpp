@@ -0,0 +1,223 @@
+/*
+  ==============================================================================
+
+    AnalyzerBenchmarks.cpp
+    Created: 18 Oct 2026 11:52:08am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+#include "../../Source/GUI/FFTDataGenerator.h"
+#include "../../Source/GUI/MultiResolutionAnalyzer.h"
+#include "../../Source/GUI/SpectrumAnalyzer.h"
+
+//==============================================================================
+static void fillWithNoise(AnalysisRingBuffer& ringBuffer)
+{
+    juce::Random r{ 1234 };
+    std::vector<float> noise(ringBuffer.getCapacity());
+
+    for (auto& sample : noise)
+    {
+        sample = r.nextFloat() * 2.f - 1.f;
+    }
+
+    ringBuffer.write(noise.data(), (int)noise.size());
+}
+
+/*
+ per-frame cost of FFTDataGenerator at every resolution:
+ windowed unwrap, FFT, normalization and dB conversion.
+ */
+static void benchmarkFFTFrame(BenchmarkRunner& runner)
+{
+    AnalysisRingBuffer ringBuffer;
+    ringBuffer.prepare(FFTDataGenerator<std::vector<float>>::getMaxFFTSize());
+    fillWithNoise(ringBuffer);
+
+    FFTDataGenerator<std::vector<float>> generator;
+
+    for (auto order : { FFTOrder::order2048, FFTOrder::order4096, FFTOrder::order8192 })
+    {
+        generator.changeOrder(order);
+        generator.applyPendingOrder();
+
+        auto fftSize = generator.getFFTSize();
+
+        runner.run("analyzer/fftFrame/" + juce::String(fftSize), 2000, fftSize / 2, [&]()
+        {
+            generator.produceFFTDataForRendering(ringBuffer, NEGATIVE_INFINITY);
+        });
+    }
+}
+
+/*
+ the multi-resolution analyzer over one hop of the full rate stage (a quarter of its
+ small FFT): decimation plus every stage frame that falls due, on average.
+ compare with analyzer/fftFrame/8192, which gives the same bass resolution per frame.
+ */
+static void benchmarkMultiResolution(BenchmarkRunner& runner)
+{
+    MultiResolutionAnalyzer analyzer;
+
+    const auto hopSize = MultiResolutionAnalyzer::getStageFFTSize() / 4;
+
+    juce::Random r{ 1234 };
+    std::vector<float> noise(hopSize);
+    for (auto& sample : noise)
+    {
+        sample = r.nextFloat() * 2.f - 1.f;
+    }
+
+    runner.run("analyzer/multiResolution/hop", 2000, hopSize, [&]()
+    {
+        analyzer.push(noise.data(), hopSize);
+        analyzer.produceFFTDataForRendering(NEGATIVE_INFINITY);
+    });
+}
+
+/*
+ the magnitude -> dB post-processing alone, against the two scalar loops it replaced.
+ */
+static void benchmarkMagnitudesToDecibels(BenchmarkRunner& runner)
+{
+    juce::Random r{ 1234 };
+
+    for (auto order : { FFTOrder::order2048, FFTOrder::order4096, FFTOrder::order8192 })
+    {
+        auto numBins = (1 << order) / 2;
+
+        std::vector<float> magnitudes(numBins);
+        for (auto& m : magnitudes)
+        {
+            m = r.nextFloat() * (float)numBins;
+        }
+
+        std::vector<float> data(numBins);
+        const auto scale = 1.f / (float)numBins;
+
+        runner.run("analyzer/magnitudesToDecibels/" + juce::String(numBins * 2), 5000, numBins, [&]()
+        {
+            std::copy(magnitudes.begin(), magnitudes.end(), data.begin());
+            magnitudesToDecibels(data.data(), numBins, scale, NEGATIVE_INFINITY);
+        });
+
+        runner.run("analyzer/scalarDecibels/" + juce::String(numBins * 2), 5000, numBins, [&]()
+        {
+            std::copy(magnitudes.begin(), magnitudes.end(), data.begin());
+
+            for (auto& v : data)
+            {
+                v = (!std::isinf(v) && !std::isnan(v)) ? v * scale : 0.f;
+            }
+
+            for (auto& v : data)
+            {
+                v = juce::Decibels::gainToDecibels(v, NEGATIVE_INFINITY);
+            }
+        });
+    }
+}
+
+/*
+ SpectrumAnalyzer::paint with the static layers redrawn on every frame (what paint used to do,
+ plus the cost of rebuilding the cache image) against the cached background.
+ resized() is how the cache is dropped, but it also clears the waterfall and gain reduction
+ images, so it is timed alone too: the static layers cost the first case minus that one.
+ they are 4 fills and outlines, 18 grid lines and 18 labels, each a String, a getStringWidth()
+ and a drawFittedText(), and 6 vectors; the cached frame has a single drawImage() instead.
+ */
+static void benchmarkAnalyzerPaint(BenchmarkRunner& runner)
+{
+    SimpleMBCompAudioProcessor processor;
+    SpectrumAnalyzer analyzer(processor);
+    analyzer.setSize(600, 225);
+
+    juce::Image image(juce::Image::RGB, analyzer.getWidth(), analyzer.getHeight(), true);
+    juce::Graphics g(image);
+
+    runner.run("analyzer/paint/staticLayersEveryFrame", 500, 1, [&]()
+    {
+        analyzer.resized();
+        analyzer.paintEntireComponent(g, false);
+    });
+
+    runner.run("analyzer/paint/resizedOnly", 500, 1, [&]()
+    {
+        analyzer.resized();
+    });
+
+    runner.run("analyzer/paint/cachedStaticLayers", 500, 1, [&]()
+    {
+        analyzer.paintEntireComponent(g, false);
+    });
+}
+
+/*
+ stroking one spectrum trace: a vertex for every bin, the way paths used to be generated,
+ against the per-column min/max envelope of AnalyzerPathGenerator.
+ */
+static void benchmarkPathStroke(BenchmarkRunner& runner)
+{
+    AnalysisRingBuffer ringBuffer;
+    ringBuffer.prepare(FFTDataGenerator<std::vector<float>>::getMaxFFTSize());
+    fillWithNoise(ringBuffer);
+
+    FFTDataGenerator<std::vector<float>> generator;
+    generator.changeOrder(FFTOrder::order8192);
+    generator.applyPendingOrder();
+    generator.produceFFTDataForRendering(ringBuffer, NEGATIVE_INFINITY);
+
+    const auto fftSize = generator.getFFTSize();
+    const auto numBins = fftSize / 2;
+    const auto binWidth = 44100.f / (float)fftSize;
+    const auto& data = generator.getFFTData();
+
+    const juce::Rectangle<float> bounds(0.f, 0.f, 600.f, 200.f);
+
+    juce::Path everyBin;
+    for (int i = 1; i < numBins; ++i)
+    {
+        auto x = juce::mapFromLog10(juce::jmax(MIN_FREQUENCY, i * binWidth), MIN_FREQUENCY, MAX_FREQUENCY);
+        auto y = juce::jmap(data[i], NEGATIVE_INFINITY, MAX_DECIBELS, bounds.getBottom(), bounds.getY());
+
+        if (i == 1)
+        {
+            everyBin.startNewSubPath(x * bounds.getWidth(), y);
+        }
+        else
+        {
+            everyBin.lineTo(x * bounds.getWidth(), y);
+        }
+    }
+
+    AnalyzerPathGenerator<juce::Path> envelopeGenerator;
+    envelopeGenerator.generatePath(data, bounds, fftSize, binWidth, NEGATIVE_INFINITY);
+    envelopeGenerator.pullLatestPath();
+
+    juce::Image image(juce::Image::RGB, (int)bounds.getWidth(), (int)bounds.getHeight(), true);
+    juce::Graphics g(image);
+    g.setColour(juce::Colours::lightblue);
+
+    runner.run("analyzer/stroke/everyBin", 500, 1, [&]()
+    {
+        g.strokePath(everyBin, juce::PathStrokeType(1.f));
+    });
+
+    runner.run("analyzer/stroke/columnEnvelope", 500, 1, [&]()
+    {
+        g.strokePath(envelopeGenerator.getPath(), juce::PathStrokeType(1.f));
+    });
+}
+
+//==============================================================================
+void runAnalyzerBenchmarks(BenchmarkRunner& runner)
+{
+    benchmarkFFTFrame(runner);
+    benchmarkMultiResolution(runner);
+    benchmarkMagnitudesToDecibels(runner);
+    benchmarkAnalyzerPaint(runner);
+    benchmarkPathStroke(runner);
+}
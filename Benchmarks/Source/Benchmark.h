@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    Benchmark.h
+    Created: 18 Oct 2026 11:52:08am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ minimal timing harness: every case is warmed up, then timed over a few runs
+ and the fastest run is kept, which is the least noisy figure on a busy machine.
+*/
+struct BenchmarkRunner
+{
+    struct Result
+    {
+        juce::String name;
+        double nsPerIteration;
+        double nsPerItem;
+    };
+
+    template<typename Fn>
+    void run(const juce::String& name, int iterations, double itemsPerIteration, Fn&& fn)
+    {
+        for (int i = 0; i < juce::jmax(1, iterations / 10); ++i)
+        {
+            fn();
+        }
+
+        auto best = std::numeric_limits<double>::max();
+
+        for (int r = 0; r < NumRuns; ++r)
+        {
+            auto start = juce::Time::getHighResolutionTicks();
+
+            for (int i = 0; i < iterations; ++i)
+            {
+                fn();
+            }
+
+            auto elapsed = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+            best = juce::jmin(best, elapsed);
+        }
+
+        auto nsPerIteration = best * 1.0e9 / iterations;
+        results.push_back({ name, nsPerIteration, nsPerIteration / itemsPerIteration });
+
+        std::cout << name.paddedRight(' ', 48)
+                  << juce::String(nsPerIteration / 1000.0, 2).paddedLeft(' ', 12) << " us/iter"
+                  << juce::String(nsPerIteration / itemsPerIteration, 3).paddedLeft(' ', 12) << " ns/item"
+                  << std::endl;
+    }
+
+    /*
+     every result so far, with enough about the machine and the build to tell runs apart:
+     { "machine": {...}, "build": {...}, "results": [ { "name", "nsPerIteration", "nsPerItem" }, ... ] }
+     */
+    bool writeJson(const juce::File& file) const
+    {
+        auto* machine = new juce::DynamicObject();
+        machine->setProperty("cpu", juce::SystemStats::getCpuModel());
+        machine->setProperty("numCpus", juce::SystemStats::getNumCpus());
+        machine->setProperty("cpuSpeedMHz", juce::SystemStats::getCpuSpeedInMegahertz());
+        machine->setProperty("os", juce::SystemStats::getOperatingSystemName());
+
+        auto* build = new juce::DynamicObject();
+        build->setProperty("date", __DATE__ " " __TIME__);
+        build->setProperty("juce", juce::SystemStats::getJUCEVersion());
+       #if JUCE_DEBUG
+        build->setProperty("config", "Debug");
+       #else
+        build->setProperty("config", "Release");
+       #endif
+
+        juce::Array<juce::var> entries;
+        for (const auto& result : results)
+        {
+            auto* entry = new juce::DynamicObject();
+            entry->setProperty("name", result.name);
+            entry->setProperty("nsPerIteration", result.nsPerIteration);
+            entry->setProperty("nsPerItem", result.nsPerItem);
+            entries.add(juce::var(entry));
+        }
+
+        auto* root = new juce::DynamicObject();
+        root->setProperty("timestamp", juce::Time::getCurrentTime().toISO8601(true));
+        root->setProperty("machine", juce::var(machine));
+        root->setProperty("build", juce::var(build));
+        root->setProperty("results", entries);
+
+        return file.replaceWithText(juce::JSON::toString(juce::var(root)));
+    }
+
+    std::vector<Result> results;
+private:
+    static constexpr int NumRuns = 5;
+};
+
+//==============================================================================
+void runAnalyzerBenchmarks(BenchmarkRunner& runner);
+void runStateBenchmarks(BenchmarkRunner& runner);
+void runProcessorBenchmarks(BenchmarkRunner& runner);
+
+/*
+ runs processBlock through automation, block size changes and state restores
+ while watching for heap and lock use. returns the number of failed scenarios.
+ */
+int runRealtimeSafetyChecks();
@@ -0,0 +1,46 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 18 Oct 2026 11:52:08am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "Benchmark.h"
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    // --json <file> also writes every result there, to compare builds
+    juce::ArgumentList args(argc, argv);
+
+    // --rt-safety only runs the audio thread checks, and fails if any scenario does
+    if (args.containsOption("--rt-safety"))
+    {
+        return runRealtimeSafetyChecks() == 0 ? 0 : 1;
+    }
+
+    BenchmarkRunner runner;
+
+    runProcessorBenchmarks(runner);
+    runAnalyzerBenchmarks(runner);
+    runStateBenchmarks(runner);
+
+    if (args.containsOption("--json"))
+    {
+        auto file = args.getFileForOption("--json");
+
+        if (!runner.writeJson(file))
+        {
+            std::cout << "cannot write " << file.getFullPathName() << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,255 @@
+/*
+  ==============================================================================
+
+    ProcessorBenchmarks.cpp
+    Created: 21 Oct 2026 4:45:12pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+#include "../../Source/PluginProcessor.h"
+
+//==============================================================================
+namespace
+{
+    enum class BandState
+    {
+        AllActive,
+        Bypassed,
+        Muted,
+        Soloed
+    };
+
+    const char* getName(BandState state)
+    {
+        switch (state)
+        {
+            case BandState::AllActive: return "active";
+            case BandState::Bypassed: return "bypassed";
+            case BandState::Muted: return "muted";
+            case BandState::Soloed: return "soloed";
+        }
+
+        return "";
+    }
+
+    /*
+     settings where every compressor works: low thresholds, a clear ratio.
+     'state' then bypasses all bands, or mutes or solos the mid band.
+     */
+    void applyBandState(SimpleMBCompAudioProcessor& processor, BandState state)
+    {
+        using namespace Params;
+
+        Values values;
+        for (const auto& spec : Table)
+        {
+            values[spec.name] = spec.defaultValue;
+        }
+
+        for (auto name : { Threshold_Low_Band, Threshold_Mid_Band, Threshold_High_Band })
+        {
+            values[name] = -30.f;
+        }
+
+        for (auto name : { Ratio_Low_Band, Ratio_Mid_Band, Ratio_High_Band })
+        {
+            values[name] = 4.f;
+        }
+
+        if (state == BandState::Bypassed)
+        {
+            for (auto name : { Bypassed_Low_Band, Bypassed_Mid_Band, Bypassed_High_Band })
+            {
+                values[name] = 1.f;
+            }
+        }
+
+        values[Mute_Mid_Band] = state == BandState::Muted ? 1.f : 0.f;
+        values[Solo_Mid_Band] = state == BandState::Soloed ? 1.f : 0.f;
+
+        processor.parameters.writeValues(values);
+    }
+
+    bool prepare(SimpleMBCompAudioProcessor& processor, int numChannels, double sampleRate, int blockSize)
+    {
+        auto channelSet = juce::AudioChannelSet::canonicalChannelSet(numChannels);
+
+        juce::AudioProcessor::BusesLayout layout;
+        layout.inputBuses.add(channelSet);
+        layout.outputBuses.add(channelSet);
+
+        if (!processor.setBusesLayout(layout))
+        {
+            return false;
+        }
+
+        processor.prepareToPlay(sampleRate, blockSize);
+        return true;
+    }
+
+    void fillWithNoise(juce::AudioBuffer<float>& buffer, juce::Random& r)
+    {
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        {
+            auto* samples = buffer.getWritePointer(channel);
+
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+            {
+                samples[i] = (r.nextFloat() * 2.f - 1.f) * 0.5f;
+            }
+        }
+    }
+
+    /*
+     enough blocks for half a second of audio per run.
+     */
+    int getIterations(double sampleRate, int blockSize)
+    {
+        return juce::jmax(1, int(sampleRate * 0.5 / blockSize));
+    }
+}
+
+/*
+ processBlock as a whole, in ns per sample (per channel frame), across the configurations
+ hosts run it in. the input is refreshed from a noise buffer before every block, which
+ is part of the figure but the same for every build.
+ */
+static void benchmarkProcessBlock(BenchmarkRunner& runner)
+{
+    SimpleMBCompAudioProcessor processor;
+    juce::Random r{ 1234 };
+    juce::MidiBuffer midi;
+
+    for (auto sampleRate : { 44100.0, 48000.0, 96000.0, 192000.0 })
+    {
+        for (int blockSize = 16; blockSize <= 4096; blockSize *= 2)
+        {
+            for (auto numChannels : { 1, 2 })
+            {
+                if (!prepare(processor, numChannels, sampleRate, blockSize))
+                {
+                    continue;
+                }
+
+                juce::AudioBuffer<float> noise(numChannels, blockSize);
+                fillWithNoise(noise, r);
+
+                juce::AudioBuffer<float> buffer(numChannels, blockSize);
+
+                for (auto state : { BandState::AllActive, BandState::Bypassed, BandState::Muted, BandState::Soloed })
+                {
+                    applyBandState(processor, state);
+
+                    auto name = "process/" + juce::String(juce::roundToInt(sampleRate))
+                        + "/" + juce::String(blockSize)
+                        + "/" + (numChannels == 1 ? "mono" : "stereo")
+                        + "/" + getName(state);
+
+                    runner.run(name, getIterations(sampleRate, blockSize), blockSize, [&]()
+                    {
+                        for (int channel = 0; channel < numChannels; ++channel)
+                        {
+                            buffer.copyFrom(channel, 0, noise, channel, 0, blockSize);
+                        }
+
+                        processor.processBlock(buffer, midi);
+                    });
+                }
+            }
+        }
+    }
+
+    processor.releaseResources();
+}
+
+//==============================================================================
+/**
+ the stages of processBlock timed on their own, at 48 kHz, stereo, 512 samples.
+ they run in processBlock's order on the same buffers, so each one sees the data
+ it would see there.
+*/
+struct ProcessorStageBenchmark
+{
+    static void run(BenchmarkRunner& runner)
+    {
+        constexpr double sampleRate = 48000.0;
+        constexpr int blockSize = 512;
+        constexpr int numChannels = 2;
+
+        SimpleMBCompAudioProcessor processor;
+        if (!prepare(processor, numChannels, sampleRate, blockSize))
+        {
+            return;
+        }
+
+        applyBandState(processor, BandState::AllActive);
+
+        juce::Random r{ 1234 };
+        juce::AudioBuffer<float> buffer(numChannels, blockSize);
+        fillWithNoise(buffer, r);
+
+        // settles every stage on the current parameters, and fills the band buffers
+        processor.updateState(blockSize);
+        processor.splitBands(buffer);
+
+        const auto iterations = getIterations(sampleRate, blockSize);
+        const auto prefix = juce::String("stage/48000/512/stereo/");
+
+        runner.run(prefix + "updateState", iterations, blockSize, [&]()
+        {
+            processor.updateState(blockSize);
+        });
+
+        runner.run(prefix + "inputGain", iterations, blockSize, [&]()
+        {
+            processor.applyGain(buffer, processor.inputGain);
+        });
+
+        runner.run(prefix + "splitBands", iterations, blockSize, [&]()
+        {
+            processor.splitBands(buffer);
+        });
+
+        const char* bandNames[] = { "low", "mid", "high" };
+
+        for (size_t band = 0; band < processor.compressors.size(); ++band)
+        {
+            // the compressor works on its band buffer in place, so every run gets a fresh copy
+            juce::AudioBuffer<float> bandInput(processor.filterBuffers[band]);
+
+            runner.run(prefix + "compressor/" + bandNames[band], iterations, blockSize, [&]()
+            {
+                auto& bandBuffer = processor.filterBuffers[band];
+
+                for (int channel = 0; channel < numChannels; ++channel)
+                {
+                    bandBuffer.copyFrom(channel, 0, bandInput, channel, 0, blockSize);
+                }
+
+                processor.compressors[band].process(bandBuffer, processor.isFeedingTelemetry());
+            });
+        }
+
+        runner.run(prefix + "mixBands", iterations, blockSize, [&]()
+        {
+            processor.mixBands(buffer);
+        });
+
+        runner.run(prefix + "outputGain", iterations, blockSize, [&]()
+        {
+            processor.applyGain(buffer, processor.outputGain);
+        });
+
+        processor.releaseResources();
+    }
+};
+
+//==============================================================================
+void runProcessorBenchmarks(BenchmarkRunner& runner)
+{
+    benchmarkProcessBlock(runner);
+    ProcessorStageBenchmark::run(runner);
+}
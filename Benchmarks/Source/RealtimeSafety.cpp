@@ -0,0 +1,243 @@
+/*
+  ==============================================================================
+
+    RealtimeSafety.cpp
+    Created: 22 Oct 2026 10:11:36am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "RealtimeSafety.h"
+
+#if SIMPLEMBCOMP_RT_SAFETY_CHECKS && JUCE_LINUX
+ #include <dlfcn.h>
+ #include <pthread.h>
+#endif
+
+//==============================================================================
+namespace
+{
+    std::atomic<int> allocations{ 0 };
+    std::atomic<int> deallocations{ 0 };
+    std::atomic<int> locks{ 0 };
+
+    // trivial thread_locals: reading them never allocates, not even on a thread's first use
+    thread_local int audioThreadDepth = 0;
+
+    // set while operator new calls malloc, so one allocation is only counted once
+    thread_local int interposerDepth = 0;
+
+    bool isCounting()
+    {
+        return audioThreadDepth > 0 && interposerDepth == 0;
+    }
+
+    void noteAllocation()
+    {
+        if (isCounting())
+        {
+            allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void noteDeallocation()
+    {
+        if (isCounting())
+        {
+            deallocations.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void noteLock()
+    {
+        if (isCounting())
+        {
+            locks.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool RealtimeSafety::isEnabled()
+{
+   #if SIMPLEMBCOMP_RT_SAFETY_CHECKS
+    return true;
+   #else
+    return false;
+   #endif
+}
+
+RealtimeSafety::ScopedAudioThread::ScopedAudioThread()
+{
+    ++audioThreadDepth;
+}
+
+RealtimeSafety::ScopedAudioThread::~ScopedAudioThread()
+{
+    --audioThreadDepth;
+}
+
+RealtimeSafety::Violations RealtimeSafety::takeViolations()
+{
+    Violations violations;
+    violations.allocations = allocations.exchange(0);
+    violations.deallocations = deallocations.exchange(0);
+    violations.locks = locks.exchange(0);
+
+    return violations;
+}
+
+#if SIMPLEMBCOMP_RT_SAFETY_CHECKS
+//==============================================================================
+namespace
+{
+    struct ScopedInterposer
+    {
+        ScopedInterposer() { ++interposerDepth; }
+        ~ScopedInterposer() { --interposerDepth; }
+    };
+
+    void* allocate(std::size_t size)
+    {
+        noteAllocation();
+
+        const ScopedInterposer interposer;
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void deallocate(void* p)
+    {
+        if (p == nullptr)
+        {
+            return;
+        }
+
+        noteDeallocation();
+
+        const ScopedInterposer interposer;
+        std::free(p);
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    if (auto* p = allocate(size))
+    {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void* p) noexcept { deallocate(p); }
+void operator delete[](void* p) noexcept { deallocate(p); }
+void operator delete(void* p, std::size_t) noexcept { deallocate(p); }
+void operator delete[](void* p, std::size_t) noexcept { deallocate(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { deallocate(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { deallocate(p); }
+
+#if JUCE_LINUX
+//==============================================================================
+// glibc keeps its own allocator reachable under these names, so replacing the public
+// ones catches every caller, JUCE and the standard library included
+extern "C"
+{
+    void* __libc_malloc(size_t);
+    void* __libc_calloc(size_t, size_t);
+    void* __libc_realloc(void*, size_t);
+    void* __libc_memalign(size_t, size_t);
+    void __libc_free(void*);
+
+    void* malloc(size_t size)
+    {
+        noteAllocation();
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t count, size_t size)
+    {
+        noteAllocation();
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* p, size_t size)
+    {
+        noteAllocation();
+        return __libc_realloc(p, size);
+    }
+
+    void* aligned_alloc(size_t alignment, size_t size)
+    {
+        noteAllocation();
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void** result, size_t alignment, size_t size)
+    {
+        noteAllocation();
+        *result = __libc_memalign(alignment, size);
+        return *result != nullptr ? 0 : ENOMEM;
+    }
+
+    void free(void* p)
+    {
+        if (p != nullptr)
+        {
+            noteDeallocation();
+        }
+
+        __libc_free(p);
+    }
+
+    using MutexFunction = int (*)(pthread_mutex_t*);
+
+    /*
+     the next definition along, libc's or libpthread's. dlsym neither allocates
+     nor takes a pthread mutex, so this cannot recurse.
+     */
+    static MutexFunction findNext(std::atomic<MutexFunction>& cache, const char* name)
+    {
+        auto function = cache.load(std::memory_order_relaxed);
+
+        if (function == nullptr)
+        {
+            function = reinterpret_cast<MutexFunction>(dlsym(RTLD_NEXT, name));
+            cache.store(function, std::memory_order_relaxed);
+        }
+
+        return function;
+    }
+
+    int pthread_mutex_lock(pthread_mutex_t* mutex)
+    {
+        static std::atomic<MutexFunction> next{ nullptr };
+
+        noteLock();
+        return findNext(next, "pthread_mutex_lock")(mutex);
+    }
+
+    int pthread_mutex_trylock(pthread_mutex_t* mutex)
+    {
+        static std::atomic<MutexFunction> next{ nullptr };
+
+        noteLock();
+        return findNext(next, "pthread_mutex_trylock")(mutex);
+    }
+}
+#endif
+#endif
@@ -0,0 +1,49 @@
+/*
+  ==============================================================================
+
+    RealtimeSafety.h
+    Created: 22 Oct 2026 10:11:36am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ catches heap and lock use where the audio thread must not have any.
+
+ built with SIMPLEMBCOMP_RT_SAFETY_CHECKS=1, this replaces the global operator new and
+ delete, and on Linux malloc, free and pthread_mutex_lock as well, with versions that
+ count every call made inside a ScopedAudioThread before doing the real work.
+ without the flag nothing is replaced and isEnabled() is false.
+*/
+namespace RealtimeSafety
+{
+    struct Violations
+    {
+        int allocations = 0;
+        int deallocations = 0;
+        int locks = 0;
+
+        bool any() const { return allocations + deallocations + locks > 0; }
+    };
+
+    bool isEnabled();
+
+    /*
+     counts what the current thread does until it goes out of scope.
+     */
+    struct ScopedAudioThread
+    {
+        ScopedAudioThread();
+        ~ScopedAudioThread();
+    };
+
+    /*
+     what every ScopedAudioThread counted since the last call, which starts a new count.
+     */
+    Violations takeViolations();
+}
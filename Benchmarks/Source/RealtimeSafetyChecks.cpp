@@ -0,0 +1,289 @@
+/*
+  ==============================================================================
+
+    RealtimeSafetyChecks.cpp
+    Created: 22 Oct 2026 11:02:19am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+#include "RealtimeSafety.h"
+#include "../../Source/PluginProcessor.h"
+
+//==============================================================================
+namespace
+{
+    /*
+     drives a processor the way a host does: blocks on the "audio thread", which is
+     watched, and everything else (automation, state, preparing) in between, which is not.
+     */
+    struct Host
+    {
+        SimpleMBCompAudioProcessor processor;
+        juce::Random random{ 1234 };
+
+        bool prepare(int numChannels, double sampleRate, int maxBlockSize)
+        {
+            auto channelSet = juce::AudioChannelSet::canonicalChannelSet(numChannels);
+
+            juce::AudioProcessor::BusesLayout layout;
+            layout.inputBuses.add(channelSet);
+            layout.outputBuses.add(channelSet);
+
+            if (!processor.setBusesLayout(layout))
+            {
+                return false;
+            }
+
+            processor.prepareToPlay(sampleRate, maxBlockSize);
+            buffer.setSize(numChannels, maxBlockSize);
+
+            return true;
+        }
+
+        void processBlock(int numSamples)
+        {
+            jassert(numSamples <= buffer.getNumSamples());
+
+            for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            {
+                auto* samples = buffer.getWritePointer(channel);
+
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    samples[i] = (random.nextFloat() * 2.f - 1.f) * 0.5f;
+                }
+            }
+
+            // the host's view of the first numSamples, as hosts hand them over
+            juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), numSamples);
+
+            const RealtimeSafety::ScopedAudioThread audioThread;
+            processor.processBlock(block, midi);
+        }
+
+        void automateRandomParameters(int count)
+        {
+            auto& params = processor.getParameters();
+
+            for (int i = 0; i < count; ++i)
+            {
+                params[random.nextInt(params.size())]->setValueNotifyingHost(random.nextFloat());
+            }
+        }
+
+        /*
+         a scenario's own checks, reported next to the realtime safety ones.
+         */
+        void expect(bool condition, const char* failure)
+        {
+            if (!condition)
+            {
+                failures.add(failure);
+            }
+        }
+
+        juce::StringArray failures;
+    private:
+        juce::AudioBuffer<float> buffer;
+        juce::MidiBuffer midi;
+    };
+
+    constexpr int NumBlocks = 400;
+
+    void steadyBlocks(Host& host)
+    {
+        host.prepare(2, 48000.0, 512);
+
+        for (int i = 0; i < NumBlocks; ++i)
+        {
+            host.processBlock(512);
+        }
+    }
+
+    void automation(Host& host)
+    {
+        host.prepare(2, 48000.0, 512);
+
+        for (int i = 0; i < NumBlocks; ++i)
+        {
+            host.automateRandomParameters(4);
+            host.processBlock(512);
+        }
+    }
+
+    void blockSizeChanges(Host& host)
+    {
+        for (auto numChannels : { 1, 2 })
+        {
+            for (auto sampleRate : { 44100.0, 96000.0 })
+            {
+                for (auto maxBlockSize : { 64, 1024 })
+                {
+                    host.prepare(numChannels, sampleRate, maxBlockSize);
+
+                    // hosts may send anything up to the prepared size, in any order
+                    for (int i = 0; i < NumBlocks / 4; ++i)
+                    {
+                        host.processBlock(1 + host.random.nextInt(maxBlockSize));
+                    }
+                }
+            }
+        }
+    }
+
+    void stateRestores(Host& host)
+    {
+        auto& processor = host.processor;
+        host.prepare(2, 48000.0, 512);
+
+        juce::MemoryBlock binaryState, valueTreeState;
+        host.automateRandomParameters(processor.getParameters().size());
+        processor.getStateInformation(binaryState);
+
+        host.automateRandomParameters(processor.getParameters().size());
+        juce::MemoryOutputStream mos(valueTreeState, false);
+        processor.apvts.copyState().writeToStream(mos);
+
+        auto& snapshots = processor.getSnapshots();
+
+        for (int i = 0; i < NumBlocks; ++i)
+        {
+            switch (i % 5)
+            {
+                case 0: processor.setStateInformation(binaryState.getData(), (int)binaryState.getSize()); break;
+                case 1: processor.setStateInformation(valueTreeState.getData(), (int)valueTreeState.getSize()); break;
+                case 2: snapshots.switchTo(i % 2 == 0 ? SnapshotBank::A : SnapshotBank::B, processor.parameters); break;
+                case 3: snapshots.morph(SnapshotBank::A, SnapshotBank::B, host.random.nextFloat(), processor.parameters); break;
+                case 4: snapshots.commitMorph(processor.parameters); break;
+            }
+
+            host.processBlock(512);
+        }
+    }
+
+    void analyzerFeeding(Host& host)
+    {
+        auto& processor = host.processor;
+        processor.addAnalyzerConsumer();
+
+        for (auto numChannels : { 1, 2 })
+        {
+            host.prepare(numChannels, 48000.0, 512);
+
+            for (int i = 0; i < NumBlocks; ++i)
+            {
+                if (i % 50 == 0)
+                {
+                    using Tap = SimpleMBCompAudioProcessor::AnalyzerTap;
+                    processor.setAnalyzerTap(i % 100 == 0 ? Tap::PreCompression : Tap::PostCompression);
+                }
+
+                host.processBlock(1 + host.random.nextInt(512));
+            }
+        }
+
+        processor.removeAnalyzerConsumer();
+    }
+
+    void analyzerIdle(Host& host)
+    {
+        using Tap = SimpleMBCompAudioProcessor::AnalyzerTap;
+        auto& processor = host.processor;
+
+        auto fifosFed = [&processor]
+        {
+            return processor.leftChannelFifo.genNumCompleteBuffersAvailable() > 0
+                && processor.rightChannelFifo.genNumCompleteBuffersAvailable() > 0;
+        };
+
+        auto fifosEmpty = [&processor]
+        {
+            return processor.leftChannelFifo.genNumCompleteBuffersAvailable() == 0
+                && processor.rightChannelFifo.genNumCompleteBuffersAvailable() == 0;
+        };
+
+        // nobody is listening: neither tap may feed the fifos
+        for (auto tap : { Tap::PreCompression, Tap::PostCompression })
+        {
+            host.prepare(2, 48000.0, 512);
+            processor.setAnalyzerTap(tap);
+
+            for (int i = 0; i < NumBlocks / 4; ++i)
+            {
+                host.processBlock(512);
+            }
+
+            host.expect(fifosEmpty(), "the fifos were fed without a consumer");
+        }
+
+        // and the first consumer brings them back
+        processor.addAnalyzerConsumer();
+
+        for (auto tap : { Tap::PreCompression, Tap::PostCompression })
+        {
+            host.prepare(2, 48000.0, 512);
+            processor.setAnalyzerTap(tap);
+
+            for (int i = 0; i < 4; ++i)
+            {
+                host.processBlock(512);
+            }
+
+            host.expect(fifosFed(), "the fifos were not fed after addAnalyzerConsumer()");
+        }
+
+        processor.removeAnalyzerConsumer();
+    }
+}
+
+//==============================================================================
+int runRealtimeSafetyChecks()
+{
+    if (!RealtimeSafety::isEnabled())
+    {
+        std::cout << "built without SIMPLEMBCOMP_RT_SAFETY_CHECKS, nothing is checked" << std::endl;
+        return 1;
+    }
+
+    const std::pair<const char*, void (*)(Host&)> scenarios[]
+    {
+        { "steadyBlocks", steadyBlocks },
+        { "automation", automation },
+        { "blockSizeChanges", blockSizeChanges },
+        { "stateRestores", stateRestores },
+        { "analyzerFeeding", analyzerFeeding },
+        { "analyzerIdle", analyzerIdle },
+    };
+
+    int numFailed = 0;
+
+    for (const auto& [name, scenario] : scenarios)
+    {
+        // a fresh instance each, so a scenario never inherits another one's buffers
+        auto host = std::make_unique<Host>();
+
+        RealtimeSafety::takeViolations();
+        scenario(*host);
+        auto violations = RealtimeSafety::takeViolations();
+        auto failed = violations.any() || !host->failures.isEmpty();
+
+        std::cout << juce::String("rtSafety/") + name << ": "
+                  << (failed ? "FAILED" : "ok")
+                  << ", " << violations.allocations << " allocations"
+                  << ", " << violations.deallocations << " deallocations"
+                  << ", " << violations.locks << " locks"
+                  << std::endl;
+
+        for (const auto& failure : host->failures)
+        {
+            std::cout << "    " << failure << std::endl;
+        }
+
+        numFailed += failed ? 1 : 0;
+    }
+
+    return numFailed;
+}
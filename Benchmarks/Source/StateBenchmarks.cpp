@@ -0,0 +1,134 @@
+/*
+  ==============================================================================
+
+    StateBenchmarks.cpp
+    Created: 20 Oct 2026 4:20:11pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+#include "../../Source/PluginProcessor.h"
+#include "../../Source/DSP/PresetBank.h"
+
+//==============================================================================
+/*
+ a state where every parameter is off its default, so a load has something to do.
+ */
+static void randomizeParameters(SimpleMBCompAudioProcessor& processor, juce::Random& r)
+{
+    for (auto* param : processor.getParameters())
+    {
+        param->setValueNotifyingHost(r.nextFloat());
+    }
+}
+
+/*
+ what a session with 'NumInstances' plugins costs to open: every instance restores
+ its state, alternating between two presets so each load changes every parameter.
+ the ValueTree format is the one sessions saved before the binary format still hold.
+ */
+static void benchmarkStateLoad(BenchmarkRunner& runner)
+{
+    constexpr int NumInstances = 500;
+
+    std::vector<std::unique_ptr<SimpleMBCompAudioProcessor>> instances;
+    instances.reserve(NumInstances);
+    for (int i = 0; i < NumInstances; ++i)
+    {
+        instances.push_back(std::make_unique<SimpleMBCompAudioProcessor>());
+    }
+
+    juce::Random r{ 1234 };
+    std::array<juce::MemoryBlock, 2> binaryStates, valueTreeStates;
+
+    for (size_t i = 0; i < binaryStates.size(); ++i)
+    {
+        auto& source = *instances.front();
+        randomizeParameters(source, r);
+
+        source.getStateInformation(binaryStates[i]);
+
+        juce::MemoryOutputStream mos(valueTreeStates[i], false);
+        source.apvts.copyState().writeToStream(mos);
+    }
+
+    std::cout << "state size: binary " << binaryStates[0].getSize()
+              << " bytes, ValueTree " << valueTreeStates[0].getSize() << " bytes" << std::endl;
+
+    auto loadAll = [&instances](const std::array<juce::MemoryBlock, 2>& states, size_t& next)
+    {
+        const auto& state = states[next++ % states.size()];
+
+        for (auto& instance : instances)
+        {
+            instance->setStateInformation(state.getData(), (int)state.getSize());
+        }
+    };
+
+    size_t nextBinary = 0;
+    runner.run("state/load500/binary", 20, NumInstances, [&]() { loadAll(binaryStates, nextBinary); });
+
+    size_t nextValueTree = 0;
+    runner.run("state/load500/valueTree", 20, NumInstances, [&]() { loadAll(valueTreeStates, nextValueTree); });
+}
+
+/*
+ browsing a large bank: opening it, listing every name, and decoding one preset.
+ */
+static void benchmarkPresetBank(BenchmarkRunner& runner)
+{
+    constexpr int NumPresets = 5000;
+
+    SimpleMBCompAudioProcessor source;
+    juce::Random r{ 1234 };
+
+    std::vector<PresetBank::Preset> presets(NumPresets);
+    for (int i = 0; i < NumPresets; ++i)
+    {
+        randomizeParameters(source, r);
+
+        presets[i].name = "Preset " + juce::String(i + 1);
+        source.getStateInformation(presets[i].state);
+    }
+
+    juce::TemporaryFile file(".smbbank");
+    if (!PresetBank::write(file.getFile(), presets))
+    {
+        std::cout << "could not write " << file.getFile().getFullPathName() << std::endl;
+        return;
+    }
+
+    PresetBank bank;
+
+    runner.run("preset/open5000", 100, NumPresets, [&]()
+    {
+        bank.open(file.getFile());
+    });
+
+    int numCharacters = 0;
+    runner.run("preset/listNames5000", 20, NumPresets, [&]()
+    {
+        for (int i = 0; i < bank.getNumPresets(); ++i)
+        {
+            numCharacters += bank.getName(i).length();
+        }
+    });
+
+    Params::Values values;
+    int next = 0;
+    runner.run("preset/decode", 10000, 1, [&]()
+    {
+        bank.decode(next++ % NumPresets, values);
+    });
+
+    juce::ignoreUnused(numCharacters);
+}
+
+//==============================================================================
+void runStateBenchmarks(BenchmarkRunner& runner)
+{
+    benchmarkStateLoad(runner);
+    benchmarkPresetBank(runner);
+}
@@ -0,0 +1,71 @@
+/*
+  ==============================================================================
+
+    AnalysisRingBuffer.h
+    Created: 18 Oct 2026 10:04:12am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ holds the most recent 'capacity' samples of a mono signal.
+ incoming audio is written once, the analysis reads the newest window back
+ out of it without ever shifting the stored samples.
+*/
+struct AnalysisRingBuffer
+{
+    void prepare(int capacity)
+    {
+        jassert(juce::isPowerOfTwo(capacity));
+
+        buffer.clear();
+        buffer.resize(capacity, 0.f);
+        mask = capacity - 1;
+        writeIndex = 0;
+    }
+
+    void write(const float* data, int numSamples)
+    {
+        const auto capacity = getCapacity();
+
+        //only the newest 'capacity' samples can survive the write
+        if (numSamples > capacity)
+        {
+            data += numSamples - capacity;
+            numSamples = capacity;
+        }
+
+        auto firstPart = juce::jmin(numSamples, capacity - writeIndex);
+
+        juce::FloatVectorOperations::copy(buffer.data() + writeIndex, data, firstPart);
+        juce::FloatVectorOperations::copy(buffer.data(), data + firstPart, numSamples - firstPart);
+
+        writeIndex = (writeIndex + numSamples) & mask;
+    }
+
+    /*
+     unwraps the newest 'numSamples' samples into 'dest', multiplying them by 'window' on the way.
+     */
+    void readWindowed(float* dest, const float* window, int numSamples) const
+    {
+        const auto capacity = getCapacity();
+        jassert(numSamples <= capacity);
+
+        auto start = (writeIndex - numSamples) & mask;
+        auto firstPart = juce::jmin(numSamples, capacity - start);
+
+        juce::FloatVectorOperations::multiply(dest, buffer.data() + start, window, firstPart);
+        juce::FloatVectorOperations::multiply(dest + firstPart, buffer.data(), window + firstPart, numSamples - firstPart);
+    }
+
+    int getCapacity() const { return (int)buffer.size(); }
+private:
+    std::vector<float> buffer;
+    int mask = 0;
+    int writeIndex = 0;
+};
@@ -0,0 +1,66 @@
+/*
+  ==============================================================================
+
+    BandTelemetry.h
+    Created: 20 Oct 2026 9:47:03am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ the levels of one compressor band over its last processed block, in dB.
+ written by the audio thread and read by the GUI without locking: every value is
+ a separate relaxed atomic, meaningful on its own, so a reader may mix two
+ consecutive blocks but never sees a torn value.
+*/
+struct BandTelemetry
+{
+    static constexpr float MinimumDecibels = -100.f;
+
+    struct Levels
+    {
+        float inputPeak = MinimumDecibels;
+        float inputRms = MinimumDecibels;
+        float outputPeak = MinimumDecibels;
+        float outputRms = MinimumDecibels;
+
+        // 0 or below: how much quieter the band left the compressor than it entered
+        float gainReduction = 0.f;
+    };
+
+    /*
+     audio thread: five stores, nothing else.
+     */
+    void publish(const Levels& levels)
+    {
+        inputPeak.store(levels.inputPeak, std::memory_order_relaxed);
+        inputRms.store(levels.inputRms, std::memory_order_relaxed);
+        outputPeak.store(levels.outputPeak, std::memory_order_relaxed);
+        outputRms.store(levels.outputRms, std::memory_order_relaxed);
+        gainReduction.store(levels.gainReduction, std::memory_order_relaxed);
+    }
+
+    Levels read() const
+    {
+        Levels levels;
+
+        levels.inputPeak = inputPeak.load(std::memory_order_relaxed);
+        levels.inputRms = inputRms.load(std::memory_order_relaxed);
+        levels.outputPeak = outputPeak.load(std::memory_order_relaxed);
+        levels.outputRms = outputRms.load(std::memory_order_relaxed);
+        levels.gainReduction = gainReduction.load(std::memory_order_relaxed);
+
+        return levels;
+    }
+private:
+    std::atomic<float> inputPeak{ MinimumDecibels };
+    std::atomic<float> inputRms{ MinimumDecibels };
+    std::atomic<float> outputPeak{ MinimumDecibels };
+    std::atomic<float> outputRms{ MinimumDecibels };
+    std::atomic<float> gainReduction{ 0.f };
+};
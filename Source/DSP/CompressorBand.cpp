@@ -9,26 +9,219 @@
 */
 
 #include "CompressorBand.h"
+#include "Multiversion.h"
 
 //==============================================================================
+namespace
+{
+    /*
+     peak magnitude and sum of squares of one channel, in a single pass.
+     eight independent accumulators, so the loop vectorizes without reassociating floats.
+     */
+    SIMPLEMBCOMP_TARGET_CLONES
+    void peakAndSumOfSquares(const float* samples, int numSamples, float& peak, float& sumOfSquares)
+    {
+        constexpr int Lanes = 8;
+
+        float peaks[Lanes] = {};
+        float sums[Lanes] = {};
+
+        int i = 0;
+
+        for (; i + Lanes <= numSamples; i += Lanes)
+        {
+            for (int lane = 0; lane < Lanes; ++lane)
+            {
+                auto x = samples[i + lane];
+                peaks[lane] = juce::jmax(peaks[lane], std::abs(x));
+                sums[lane] += x * x;
+            }
+        }
+
+        for (; i < numSamples; ++i)
+        {
+            auto x = samples[i];
+            peaks[0] = juce::jmax(peaks[0], std::abs(x));
+            sums[0] += x * x;
+        }
+
+        peak = 0.f;
+        sumOfSquares = 0.f;
+
+        for (int lane = 0; lane < Lanes; ++lane)
+        {
+            peak = juce::jmax(peak, peaks[lane]);
+            sumOfSquares += sums[lane];
+        }
+    }
+
+    /*
+     what one block did to a band, summed over its channels.
+     */
+    struct LevelSums
+    {
+        float inputPeak = 0.f;
+        float inputSquares = 0.f;
+        float outputPeak = 0.f;
+        float outputSquares = 0.f;
+        float minimumGain = 1.f;
+    };
+
+    /*
+     juce::dsp::BallisticsFilter in peak mode feeding juce::dsp::Compressor's gain computer,
+     sample for sample the same arithmetic. 'Measure' adds the levels and the gain to 'sums'.
+     each sample's envelope needs the last one's, and the gain is a std::pow call, so this
+     does not vectorize and is not cloned per instruction set: the clones measured the same.
+     */
+    template<bool Measure>
+    inline void compressSamples(float* samples, int numSamples, float& envelope,
+                                const CompressorBand::Ballistics& ballistics, LevelSums& sums)
+    {
+        auto y = envelope;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            auto x = samples[i];
+            auto level = std::abs(x);
+
+            auto coefficient = level > y ? ballistics.attack : ballistics.release;
+            y = level + coefficient * (y - level);
+
+            auto gain = y < ballistics.threshold ? 1.f : std::pow(y * ballistics.thresholdInverse, ballistics.ratioExponent);
+            auto output = gain * x;
+            samples[i] = output;
+
+            if constexpr (Measure)
+            {
+                sums.inputPeak = juce::jmax(sums.inputPeak, level);
+                sums.inputSquares += x * x;
+                sums.outputPeak = juce::jmax(sums.outputPeak, std::abs(output));
+                sums.outputSquares += output * output;
+                sums.minimumGain = juce::jmin(sums.minimumGain, gain);
+            }
+        }
+
+        // as BallisticsFilter does after every block
+        juce::dsp::util::snapToZero(y);
+        envelope = y;
+    }
+
+    void compressChannel(float* samples, int numSamples, float& envelope, const CompressorBand::Ballistics& ballistics)
+    {
+        LevelSums unused;
+        compressSamples<false>(samples, numSamples, envelope, ballistics, unused);
+    }
+
+    void compressAndMeasureChannel(float* samples, int numSamples, float& envelope,
+                                   const CompressorBand::Ballistics& ballistics, LevelSums& sums)
+    {
+        compressSamples<true>(samples, numSamples, envelope, ballistics, sums);
+    }
+
+    float toDecibels(float gain)
+    {
+        return juce::Decibels::gainToDecibels(gain, BandTelemetry::MinimumDecibels);
+    }
+
+    float rmsDecibels(float sumOfSquares, int count)
+    {
+        return toDecibels(count > 0 ? std::sqrt(sumOfSquares / (float)count) : 0.f);
+    }
+}
+
 void CompressorBand::prepare(const juce::dsp::ProcessSpec& spec)
 {
-    compressor.prepare(spec);
+    expFactor = -2.0 * juce::MathConstants<double>::pi * 1000.0 / spec.sampleRate;
+    ballistics.attack = calculateCoefficient(attackTime);
+    ballistics.release = calculateCoefficient(releaseTime);
+
+    envelopes.assign(spec.numChannels, 0.f);
+
+    // 10 ms per column: a few seconds of history fit the analyzer's width
+    gainReductionHistory.prepare(spec.sampleRate, 0.01);
 }
 
-void CompressorBand::updateCompressorSettings()
+float CompressorBand::calculateCoefficient(float timeMs) const
 {
-    compressor.setAttack(attack->get());
-    compressor.setRelease(release->get());
-    compressor.setThreshold(threshold->get());
-    compressor.setRatio(ratio->getCurrentChoiceName().getFloatValue());
+    // as juce::dsp::BallisticsFilter: below a microsecond the envelope follows at once
+    return timeMs < 1.0e-3f ? 0.f : (float)std::exp(expFactor / timeMs);
+}
+
+void CompressorBand::updateCompressorSettings(const Params::Values& values)
+{
+    if (values[attack] != attackTime)
+    {
+        attackTime = values[attack];
+        ballistics.attack = calculateCoefficient(attackTime);
+    }
+
+    if (values[release] != releaseTime)
+    {
+        releaseTime = values[release];
+        ballistics.release = calculateCoefficient(releaseTime);
+    }
+
+    ballistics.threshold = juce::Decibels::decibelsToGain(values[threshold], -200.f);
+    ballistics.thresholdInverse = 1.f / ballistics.threshold;
+    ballistics.ratioExponent = 1.f / Params::ratioAt(values[ratio]) - 1.f;
+
+    isBypassed = Params::isOn(values[bypassed]);
+    muted = Params::isOn(values[mute]);
+    soloed = Params::isOn(values[solo]);
 }
 
-void CompressorBand::process(juce::AudioBuffer<float>& buffer)
+void CompressorBand::process(juce::AudioBuffer<float>& buffer, bool publishTelemetry)
 {
-    auto block = juce::dsp::AudioBlock<float>(buffer);
-    auto context = juce::dsp::ProcessContextReplacing<float>(block);
-    context.isBypassed = bypassed->get();
+    const auto numSamples = buffer.getNumSamples();
+    const auto numChannels = juce::jmin(buffer.getNumChannels(), (int)envelopes.size());
+    jassert(numChannels == buffer.getNumChannels());
 
-    compressor.process(context);
-}
\ No newline at end of file
+    if (!publishTelemetry)
+    {
+        if (!isBypassed)
+        {
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                compressChannel(buffer.getWritePointer(channel), numSamples, envelopes[(size_t)channel], ballistics);
+            }
+        }
+
+        return;
+    }
+
+    LevelSums sums;
+
+    if (isBypassed)
+    {
+        // the envelope holds, like juce::dsp::Compressor's, and the band passes unchanged
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            float peak, sumOfSquares;
+            peakAndSumOfSquares(buffer.getReadPointer(channel), numSamples, peak, sumOfSquares);
+
+            sums.inputPeak = sums.outputPeak = juce::jmax(sums.inputPeak, peak);
+            sums.inputSquares = sums.outputSquares = sums.inputSquares + sumOfSquares;
+        }
+    }
+    else
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            compressAndMeasureChannel(buffer.getWritePointer(channel), numSamples, envelopes[(size_t)channel], ballistics, sums);
+        }
+    }
+
+    const auto count = numChannels * numSamples;
+
+    BandTelemetry::Levels levels;
+    levels.inputPeak = toDecibels(sums.inputPeak);
+    levels.inputRms = rmsDecibels(sums.inputSquares, count);
+    levels.outputPeak = toDecibels(sums.outputPeak);
+    levels.outputRms = rmsDecibels(sums.outputSquares, count);
+
+    // the deepest gain the compressor applied during the block
+    levels.gainReduction = juce::jmin(0.f, toDecibels(sums.minimumGain));
+
+    telemetry.publish(levels);
+    gainReductionHistory.push(levels.gainReduction, numSamples);
+}
@@ -10,23 +10,79 @@
 
 #pragma once
 #include <JuceHeader.h>
+#include "Params.h"
+#include "BandTelemetry.h"
+#include "GainReductionHistory.h"
 
 //==============================================================================
 /**
+ one band's compressor: juce::dsp::Compressor's peak envelope and gain computer,
+ run here so the gain it applies can be reported as it is.
 */
 struct CompressorBand
 {
-    juce::AudioParameterFloat* attack{ nullptr };
-    juce::AudioParameterFloat* release{ nullptr };
-    juce::AudioParameterFloat* threshold{ nullptr };
-    juce::AudioParameterChoice* ratio{ nullptr };
-    juce::AudioParameterBool* bypassed{ nullptr };
-    juce::AudioParameterBool* mute{ nullptr };
-    juce::AudioParameterBool* solo{ nullptr };
+    /*
+     where this band's settings are in a Params::Values.
+     */
+    Params::Names attack = Params::Attack_Low_Band;
+    Params::Names release = Params::Release_Low_Band;
+    Params::Names threshold = Params::Threshold_Low_Band;
+    Params::Names ratio = Params::Ratio_Low_Band;
+    Params::Names bypassed = Params::Bypassed_Low_Band;
+    Params::Names mute = Params::Mute_Low_Band;
+    Params::Names solo = Params::Solo_Low_Band;
 
     void prepare(const juce::dsp::ProcessSpec& spec);
-    void updateCompressorSettings();
-    void process(juce::AudioBuffer<float>& buffer);
+    void updateCompressorSettings(const Params::Values& values);
+
+    /*
+     compresses 'buffer' in place. with 'publishTelemetry' the block's levels and the
+     deepest gain applied go to the telemetry and the history, otherwise nothing is measured.
+     */
+    void process(juce::AudioBuffer<float>& buffer, bool publishTelemetry);
+
+    bool isMuted() const { return muted; }
+    bool isSoloed() const { return soloed; }
+
+    /*
+     the levels of the last block processed with 'publishTelemetry', safe to read from any thread.
+     */
+    const BandTelemetry& getTelemetry() const { return telemetry; }
+
+    /*
+     the gain reduction of the last seconds, for the GUI's history graph.
+     */
+    const GainReductionHistory& getGainReductionHistory() const { return gainReductionHistory; }
+
+    /*
+     what the envelope and the gain computer run with, derived from the settings.
+     */
+    struct Ballistics
+    {
+        float threshold = 1.f;
+        float thresholdInverse = 1.f;
+        // 1 / ratio - 1
+        float ratioExponent = 0.f;
+        float attack = 0.f;
+        float release = 0.f;
+    };
 private:
-    juce::dsp::Compressor<float> compressor;
+    Ballistics ballistics;
+
+    // the settings the coefficients were computed for, so unchanged times cost no exp()
+    float attackTime = -1.f;
+    float releaseTime = -1.f;
+    double expFactor = 0.0;
+
+    // one peak envelope per channel
+    std::vector<float> envelopes;
+
+    float calculateCoefficient(float timeMs) const;
+
+    bool isBypassed = false;
+    bool muted = false;
+    bool soloed = false;
+
+    BandTelemetry telemetry;
+    GainReductionHistory gainReductionHistory;
 };
\ No newline at end of file
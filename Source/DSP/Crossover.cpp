@@ -0,0 +1,157 @@
+/*
+  ==============================================================================
+
+    Crossover.cpp
+    Created: 23 Oct 2026 10:14:27am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "Crossover.h"
+
+//==============================================================================
+namespace
+{
+    using Vector = Crossover::Vector;
+
+    constexpr float R2 = juce::MathConstants<float>::sqrt2;
+
+    struct SectionOutputs
+    {
+        Vector lowpass, bandpass, highpass;
+    };
+
+    inline SectionOutputs processSection(Vector x, const Crossover::Coefficients& c, Crossover::Section& s)
+    {
+        auto yH = (x - s.s1 * c.r2PlusG - s.s2) * c.h;
+
+        auto yB = yH * c.g + s.s1;
+        s.s1 = yH * c.g + yB;
+
+        auto yL = yB * c.g + s.s2;
+        s.s2 = yB * c.g + yL;
+
+        return { yL, yB, yH };
+    }
+
+    /*
+     the channels of one group. the state is copied in and out, so it stays in registers.
+     */
+    void splitGroup(const float* const* input, float* const* low, float* const* mid, float* const* high,
+                    int numChannels, int numSamples,
+                    const Crossover::Coefficients& lowMid, const Crossover::Coefficients& midHigh,
+                    Crossover::GroupState& groupState)
+    {
+        auto state = groupState;
+        auto x = Vector::expand(0.f);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            for (int lane = 0; lane < numChannels; ++lane)
+            {
+                x.set((size_t)lane, input[lane][i]);
+            }
+
+            auto first = processSection(x, lowMid, state.lowMid);
+
+            auto lowpass = processSection(first.lowpass, lowMid, state.lowMidLowpass).lowpass;
+            auto highpass = processSection(first.highpass, lowMid, state.lowMidHighpass).highpass;
+
+            auto allpass = processSection(lowpass, midHigh, state.allpass);
+            auto lowBand = allpass.lowpass - allpass.bandpass * R2 + allpass.highpass;
+
+            auto second = processSection(highpass, midHigh, state.midHigh);
+            auto midBand = processSection(second.lowpass, midHigh, state.midHighLowpass).lowpass;
+            auto highBand = processSection(second.highpass, midHigh, state.midHighHighpass).highpass;
+
+            for (int lane = 0; lane < numChannels; ++lane)
+            {
+                low[lane][i] = lowBand.get((size_t)lane);
+                mid[lane][i] = midBand.get((size_t)lane);
+                high[lane][i] = highBand.get((size_t)lane);
+            }
+        }
+
+        groupState = state;
+
+        // as LinkwitzRileyFilter does after every block. JUCE's snapToZero does nothing
+        // for a SIMDRegister, so lane by lane
+        for (auto* section : { &groupState.lowMid, &groupState.lowMidLowpass, &groupState.lowMidHighpass, &groupState.allpass,
+                               &groupState.midHigh, &groupState.midHighLowpass, &groupState.midHighHighpass })
+        {
+            for (auto* vector : { &section->s1, &section->s2 })
+            {
+                for (size_t lane = 0; lane < Vector::size(); ++lane)
+                {
+                    auto value = vector->get(lane);
+                    juce::dsp::util::snapToZero(value);
+                    vector->set(lane, value);
+                }
+            }
+        }
+    }
+}
+
+void Crossover::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    sampleRate = spec.sampleRate;
+
+    lowMid = calculateCoefficients(lowMidFrequency);
+    midHigh = calculateCoefficients(midHighFrequency);
+
+    states.assign((spec.numChannels + Lanes - 1) / Lanes, {});
+}
+
+Crossover::Coefficients Crossover::calculateCoefficients(float frequency) const
+{
+    // the same roundings as LinkwitzRileyFilter::update()
+    Coefficients c;
+    c.g = (float)std::tan(juce::MathConstants<double>::pi * juce::jmax(0.f, frequency) / sampleRate);
+    c.r2PlusG = R2 + c.g;
+    c.h = (float)(1.0 / (1.0 + R2 * c.g + c.g * c.g));
+
+    return c;
+}
+
+void Crossover::setCutoffFrequencies(float lowMidCutoff, float midHighCutoff)
+{
+    if (lowMidCutoff != lowMidFrequency)
+    {
+        lowMidFrequency = lowMidCutoff;
+        lowMid = calculateCoefficients(lowMidFrequency);
+    }
+
+    if (midHighCutoff != midHighFrequency)
+    {
+        midHighFrequency = midHighCutoff;
+        midHigh = calculateCoefficients(midHighFrequency);
+    }
+}
+
+void Crossover::process(const juce::AudioBuffer<float>& input, std::array<juce::AudioBuffer<float>, NumBands>& bands)
+{
+    const auto numChannels = juce::jmin(input.getNumChannels(), (int)states.size() * Lanes);
+    const auto numSamples = input.getNumSamples();
+    jassert(numChannels == input.getNumChannels());
+
+    for (auto& band : bands)
+    {
+        band.setSize(numChannels, numSamples, false, false, true);
+    }
+
+    for (int first = 0; first < numChannels; first += Lanes)
+    {
+        const auto numInGroup = juce::jmin(Lanes, numChannels - first);
+
+        splitGroup(input.getArrayOfReadPointers() + first,
+                   bands[0].getArrayOfWritePointers() + first,
+                   bands[1].getArrayOfWritePointers() + first,
+                   bands[2].getArrayOfWritePointers() + first,
+                   numInGroup,
+                   numSamples,
+                   lowMid,
+                   midHigh,
+                   states[(size_t)(first / Lanes)]);
+    }
+}
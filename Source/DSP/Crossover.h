@@ -0,0 +1,86 @@
+/*
+  ==============================================================================
+
+    Crossover.h
+    Created: 23 Oct 2026 10:14:27am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ the three band split, fourth order Linkwitz-Riley at both crossovers:
+ low is LP1 -> AP2, mid is HP1 -> LP2 and high is HP1 -> HP2.
+
+ juce::dsp::LinkwitzRileyFilter's TPT sections, with the same coefficients and the same
+ arithmetic per sample, so the same transfer functions. JUCE's lowpass and highpass each
+ run a first section of their own on the same input, here they share one.
+
+ a section is a recurrence through its state, so one channel cannot be vectorized: the
+ channels are split side by side instead, one per lane of a juce::dsp::SIMDRegister.
+*/
+struct Crossover
+{
+    static constexpr int NumBands = 3;
+
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void setCutoffFrequencies(float lowMid, float midHigh);
+
+    /*
+     splits 'input' into 'bands', lowest first. the bands keep their memory when a
+     block is shorter than the last one.
+     */
+    void process(const juce::AudioBuffer<float>& input, std::array<juce::AudioBuffer<float>, NumBands>& bands);
+
+    /*
+     one second order section: g = tan(pi fc / fs), h = 1 / (1 + sqrt(2) g + g^2).
+     */
+    struct Coefficients
+    {
+        float g = 0.f;
+        // sqrt(2) + g
+        float r2PlusG = 0.f;
+        float h = 1.f;
+    };
+
+    using Vector = juce::dsp::SIMDRegister<float>;
+
+    /*
+     the channels split together, one per lane.
+     */
+    static constexpr int Lanes = (int)Vector::SIMDNumElements;
+
+    struct Section
+    {
+        Vector s1 = Vector::expand(0.f);
+        Vector s2 = Vector::expand(0.f);
+    };
+
+    /*
+     'Lanes' channels: each crossover's shared first section and the second sections of its
+     lowpass and highpass, and the low band's allpass, a single section at 'midHigh'.
+     */
+    struct GroupState
+    {
+        Section lowMid, lowMidLowpass, lowMidHighpass;
+        Section allpass;
+        Section midHigh, midHighLowpass, midHighHighpass;
+    };
+
+private:
+    Coefficients calculateCoefficients(float frequency) const;
+
+    double sampleRate = 44100.0;
+
+    // the cutoffs the coefficients were computed for, so unchanged ones cost no tan()
+    float lowMidFrequency = -1.f;
+    float midHighFrequency = -1.f;
+
+    Coefficients lowMid, midHigh;
+    // the last group has unused lanes unless the channels fill it
+    std::vector<GroupState> states;
+};
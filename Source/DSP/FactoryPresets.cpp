@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    FactoryPresets.cpp
+    Created: 24 Oct 2026 9:41:12am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "FactoryPresets.h"
+#include "StateFormat.h"
+
+namespace
+{
+    using namespace Params;
+
+    struct Setting
+    {
+        Names name;
+        float value;
+    };
+
+    /*
+     a preset is the defaults of Params::Table with these settings on top.
+     ratios are indices into RatioChoices.
+     */
+    struct Definition
+    {
+        const char* name;
+        std::vector<Setting> settings;
+    };
+
+    const Definition definitions[]
+    {
+        { "Init", {} },
+
+        { "Gentle Glue",
+          {
+              { Threshold_Low_Band, -18.f }, { Threshold_Mid_Band, -18.f }, { Threshold_High_Band, -18.f },
+              { Attack_Low_Band, 30.f }, { Attack_Mid_Band, 30.f }, { Attack_High_Band, 30.f },
+              { Release_Low_Band, 150.f }, { Release_Mid_Band, 150.f }, { Release_High_Band, 150.f },
+              { Ratio_Low_Band, 2.f }, { Ratio_Mid_Band, 2.f }, { Ratio_High_Band, 2.f },
+          } },
+
+        { "Vocal Control",
+          {
+              { Low_Mid_Crossover_Freq, 250.f }, { Mid_High_Crossover_Freq, 4000.f },
+              { Threshold_Low_Band, -24.f }, { Threshold_Mid_Band, -20.f }, { Threshold_High_Band, -28.f },
+              { Attack_Low_Band, 20.f }, { Attack_Mid_Band, 10.f }, { Attack_High_Band, 5.f },
+              { Release_Low_Band, 200.f }, { Release_Mid_Band, 120.f }, { Release_High_Band, 80.f },
+              { Ratio_Low_Band, 3.f }, { Ratio_Mid_Band, 4.f }, { Ratio_High_Band, 5.f },
+          } },
+
+        { "Bass Tamer",
+          {
+              { Low_Mid_Crossover_Freq, 150.f },
+              { Threshold_Low_Band, -24.f }, { Attack_Low_Band, 20.f }, { Release_Low_Band, 200.f },
+              { Ratio_Low_Band, 6.f },
+              { Bypassed_Mid_Band, 1.f }, { Bypassed_High_Band, 1.f },
+          } },
+
+        { "De-Harsh",
+          {
+              { Mid_High_Crossover_Freq, 5000.f },
+              { Threshold_High_Band, -30.f }, { Attack_High_Band, 5.f }, { Release_High_Band, 60.f },
+              { Ratio_High_Band, 8.f },
+              { Bypassed_Low_Band, 1.f }, { Bypassed_Mid_Band, 1.f },
+          } },
+
+        { "Drum Bus",
+          {
+              { Threshold_Low_Band, -20.f }, { Threshold_Mid_Band, -20.f }, { Threshold_High_Band, -20.f },
+              { Attack_Low_Band, 30.f }, { Attack_Mid_Band, 30.f }, { Attack_High_Band, 30.f },
+              { Release_Low_Band, 100.f }, { Release_Mid_Band, 100.f }, { Release_High_Band, 100.f },
+              { Ratio_Low_Band, 4.f }, { Ratio_Mid_Band, 4.f }, { Ratio_High_Band, 4.f },
+              { Gain_Out, 2.f },
+          } },
+
+        { "Mastering Lite",
+          {
+              { Threshold_Low_Band, -12.f }, { Threshold_Mid_Band, -10.f }, { Threshold_High_Band, -12.f },
+              { Attack_Low_Band, 50.f }, { Attack_Mid_Band, 50.f }, { Attack_High_Band, 50.f },
+              { Ratio_Low_Band, 1.f }, { Ratio_Mid_Band, 1.f }, { Ratio_High_Band, 1.f },
+          } },
+    };
+}
+
+//==============================================================================
+std::vector<PresetBank::Preset> FactoryPresets::create()
+{
+    std::vector<PresetBank::Preset> presets;
+
+    for (const auto& definition : definitions)
+    {
+        Values values;
+        for (const auto& spec : Table)
+        {
+            values[spec.name] = spec.defaultValue;
+        }
+
+        for (const auto& setting : definition.settings)
+        {
+            values[setting.name] = setting.value;
+        }
+
+        PresetBank::Preset preset;
+        preset.name = definition.name;
+        StateFormat::write(values, preset.state);
+
+        presets.push_back(std::move(preset));
+    }
+
+    return presets;
+}
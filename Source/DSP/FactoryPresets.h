@@ -0,0 +1,24 @@
+/*
+  ==============================================================================
+
+    FactoryPresets.h
+    Created: 24 Oct 2026 9:41:12am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "PresetBank.h"
+
+//==============================================================================
+/**
+ the presets the plugin comes with, in program order. the plugin offers them while
+ there is no bank at PresetBank::getDefaultFile(), and PresetBankBuilder --factory
+ writes them first, so the first user preset saved keeps them too.
+*/
+namespace FactoryPresets
+{
+    std::vector<PresetBank::Preset> create();
+}
@@ -45,7 +45,7 @@ struct Fifo
         auto write = fifo.write(1);
         if (write.blockSize1 > 0)
         {
-            buffers[write.startIndex1] = t;
+            copy(buffers[write.startIndex1], t);
             return true;
         }
 
@@ -57,7 +57,7 @@ struct Fifo
         auto read = fifo.read(1);
         if (read.blockSize1 > 0)
         {
-            t = buffers[read.startIndex1];
+            copy(t, buffers[read.startIndex1]);
             return true;
         }
 
@@ -69,6 +69,22 @@ struct Fifo
         return fifo.getNumReady();
     }
 private:
+    /*
+     never reallocates while 'dest' is big enough: push() runs on the audio thread.
+     AudioBuffer::operator= would, as soon as the sizes differ.
+     */
+    static void copy(T& dest, const T& source)
+    {
+        if constexpr (std::is_same_v<T, juce::AudioBuffer<float>>)
+        {
+            dest.makeCopyOf(source, true);
+        }
+        else
+        {
+            dest = source;
+        }
+    }
+
     static constexpr int Capacity = 30;
     std::array<T, Capacity> buffers;
     juce::AbstractFifo fifo{ Capacity };
@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    GainReductionHistory.h
+    Created: 20 Oct 2026 1:36:52pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ the recent gain reduction of one band, decimated to one min/max column per
+ 'secondsPerColumn' and kept in a fixed ring of 'Capacity' columns.
+ single writer (the audio thread, once per block) and single reader (the GUI):
+ the writer only ever stores into the ring and bumps a counter, it never allocates or waits.
+*/
+struct GainReductionHistory
+{
+    static constexpr int Capacity = 2048;
+
+    struct Column
+    {
+        float minimum = 0.f;
+        float maximum = 0.f;
+    };
+
+    void prepare(double sampleRate, double secondsPerColumn)
+    {
+        samplesPerColumn = juce::jmax(1, juce::roundToInt(sampleRate * secondsPerColumn));
+        samplesInColumn = 0;
+        currentMinimum = currentMaximum = 0.f;
+    }
+
+    /*
+     audio thread: 'gainReduction' held for 'numSamples' samples.
+     */
+    void push(float gainReduction, int numSamples)
+    {
+        currentMinimum = samplesInColumn == 0 ? gainReduction : juce::jmin(currentMinimum, gainReduction);
+        currentMaximum = samplesInColumn == 0 ? gainReduction : juce::jmax(currentMaximum, gainReduction);
+        samplesInColumn += numSamples;
+
+        // a block longer than a column completes several of them, with the same value
+        while (samplesInColumn >= samplesPerColumn)
+        {
+            samplesInColumn -= samplesPerColumn;
+
+            auto position = written.load(std::memory_order_relaxed);
+            auto index = int(position % Capacity);
+
+            minimums[index].store(currentMinimum, std::memory_order_relaxed);
+            maximums[index].store(currentMaximum, std::memory_order_relaxed);
+            written.store(position + 1, std::memory_order_release);
+
+            currentMinimum = currentMaximum = gainReduction;
+        }
+    }
+
+    /*
+     GUI thread: the number of columns completed so far. only the newest 'Capacity'
+     of them, from getNumWritten() - Capacity on, can still be read.
+     */
+    juce::int64 getNumWritten() const { return written.load(std::memory_order_acquire); }
+
+    /*
+     GUI thread: the column completed at 'position', counting from the first one.
+     */
+    Column getColumn(juce::int64 position) const
+    {
+        auto index = int(position % Capacity);
+
+        Column column;
+        column.minimum = minimums[index].load(std::memory_order_relaxed);
+        column.maximum = maximums[index].load(std::memory_order_relaxed);
+
+        return column;
+    }
+private:
+    std::array<std::atomic<float>, Capacity> minimums{};
+    std::array<std::atomic<float>, Capacity> maximums{};
+    std::atomic<juce::int64> written{ 0 };
+
+    // audio thread only
+    int samplesPerColumn = 1;
+    int samplesInColumn = 0;
+    float currentMinimum = 0.f;
+    float currentMaximum = 0.f;
+};
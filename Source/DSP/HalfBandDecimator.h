@@ -0,0 +1,110 @@
+/*
+  ==============================================================================
+
+    HalfBandDecimator.h
+    Created: 19 Oct 2026 5:34:50pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ halves the sample rate of a mono signal through a windowed-sinc half-band FIR.
+ every other tap of a half-band filter is zero, so only those that are not get
+ evaluated, and only for the samples that are kept.
+ the passband is flat up to a quarter of the output rate, which is all the
+ analyzer reads from a decimated stage.
+*/
+struct HalfBandDecimator
+{
+    HalfBandDecimator()
+    {
+        constexpr int centre = NumTaps / 2;
+
+        for (int n = 0; n < NumTaps; ++n)
+        {
+            const auto offset = n - centre;
+
+            // the even offsets, except the centre, are the zeros of the half-band sinc
+            if (offset != 0 && offset % 2 == 0)
+            {
+                continue;
+            }
+
+            const auto pi = juce::MathConstants<double>::pi;
+            const auto sinc = offset == 0 ? 0.5 : std::sin(pi * offset / 2.0) / (pi * offset);
+            const auto window = 0.42 - 0.5 * std::cos(2.0 * pi * n / (NumTaps - 1))
+                                     + 0.08 * std::cos(4.0 * pi * n / (NumTaps - 1));
+
+            taps[numNonZeroTaps] = n;
+            coefficients[numNonZeroTaps] = float(sinc * window);
+            ++numNonZeroTaps;
+        }
+
+        // unity gain at DC
+        auto sum = std::accumulate(coefficients.begin(), coefficients.begin() + numNonZeroTaps, 0.f);
+        for (int i = 0; i < numNonZeroTaps; ++i)
+        {
+            coefficients[i] /= sum;
+        }
+
+        reset();
+    }
+
+    void reset()
+    {
+        history.fill(0.f);
+        writeIndex = 0;
+        skipNext = false;
+    }
+
+    /*
+     decimates 'numSamples' samples of 'input' into 'output', which must hold at least
+     numSamples / 2 + 1 samples. returns the number of samples written.
+     the filter state carries over, so blocks of any length, odd ones included, can be chained.
+     */
+    int process(const float* input, int numSamples, float* output)
+    {
+        int numWritten = 0;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            // stored twice, so the newest NumTaps samples are always contiguous
+            history[writeIndex] = input[i];
+            history[writeIndex + NumTaps] = input[i];
+            writeIndex = (writeIndex + 1) % NumTaps;
+
+            skipNext = !skipNext;
+            if (!skipNext)
+            {
+                continue;
+            }
+
+            const auto* window = history.data() + writeIndex;
+
+            float y = 0.f;
+            for (int t = 0; t < numNonZeroTaps; ++t)
+            {
+                y += coefficients[t] * window[taps[t]];
+            }
+
+            output[numWritten++] = y;
+        }
+
+        return numWritten;
+    }
+private:
+    static constexpr int NumTaps = 31;
+
+    std::array<int, NumTaps> taps{};
+    std::array<float, NumTaps> coefficients{};
+    int numNonZeroTaps = 0;
+
+    std::array<float, NumTaps * 2> history{};
+    int writeIndex = 0;
+    bool skipNext = false;
+};
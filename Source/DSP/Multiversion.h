@@ -0,0 +1,31 @@
+/*
+  ==============================================================================
+
+    Multiversion.h
+    Created: 22 Oct 2026 2:18:40pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//==============================================================================
+/*
+ SIMPLEMBCOMP_TARGET_CLONES in front of a kernel's definition builds it once for
+ the x86-64 baseline (SSE2), once for AVX2 and once for AVX-512, and the loader
+ picks the best one the machine has, once, through an ifunc.
+
+ only for hot loops that are ours, live in a .cpp and vectorize: code inlined from JUCE
+ gets cloned along with them, code compiled in the JUCE modules does not, and a loop
+ that stays scalar runs the same in every clone. on the audio path that is the band
+ level meters. the crossover and the compressor envelopes are recurrences: the crossover
+ is vectorized across channels with juce::dsp::SIMDRegister instead, the compressor is not.
+ the CMake build turns it on with SIMPLEMBCOMP_MULTIVERSIONING on x86-64 Linux,
+ everywhere else it expands to nothing.
+*/
+#if SIMPLEMBCOMP_MULTIVERSIONING && defined(__x86_64__) && defined(__linux__) && (defined(__GNUC__) || defined(__clang__))
+ #define SIMPLEMBCOMP_TARGET_CLONES __attribute__((target_clones("default", "avx2", "avx512f")))
+#else
+ #define SIMPLEMBCOMP_TARGET_CLONES
+#endif
@@ -10,6 +10,7 @@
 
 #pragma once
 #include <JuceHeader.h>
+#include <string_view>
 
 //==============================================================================
 /**
@@ -51,40 +52,231 @@ namespace Params
 
         Gain_In,
         Gain_Out,
+
+        NumParams
+    };
+
+    enum class Kind
+    {
+        Float,
+        Choice,
+        Bool
+    };
+
+    /*
+     everything needed to create one parameter. for a Choice the default is the index of
+     the default choice, for a Bool it is 0 or 1.
+     */
+    struct Spec
+    {
+        Names name;
+        std::string_view id;
+        Kind kind;
+        float minimum;
+        float maximum;
+        float interval;
+        float skew;
+        float defaultValue;
+        std::string_view unit;
+    };
+
+    inline constexpr std::array<double, 14> RatioChoices{ 1, 1.5, 2, 3, 4, 5, 6, 7, 8, 10, 15, 20, 50, 100 };
+
+    /*
+     indexed by Names.
+     */
+    inline constexpr std::array<Spec, NumParams> Table
+    {{
+        { Low_Mid_Crossover_Freq,  "Low-Mid Crossover Frequency",  Kind::Float,  20.f,   999.f,   1.f,   1.f, 400.f,  "Hz" },
+        { Mid_High_Crossover_Freq, "Mid-High Crossover Frequency", Kind::Float,  1000.f, 20000.f, 1.f,   1.f, 2000.f, "Hz" },
+
+        { Threshold_Low_Band,      "Threshold Low Band",           Kind::Float,  -60.f,  12.f,    1.f,   1.f, 0.f,    "dB" },
+        { Threshold_Mid_Band,      "Threshold Mid Band",           Kind::Float,  -60.f,  12.f,    1.f,   1.f, 0.f,    "dB" },
+        { Threshold_High_Band,     "Threshold High Band",          Kind::Float,  -60.f,  12.f,    1.f,   1.f, 0.f,    "dB" },
+
+        { Attack_Low_Band,         "Attack Low Band",              Kind::Float,  5.f,    500.f,   1.f,   1.f, 50.f,   "ms" },
+        { Attack_Mid_Band,         "Attack Mid Band",              Kind::Float,  5.f,    500.f,   1.f,   1.f, 50.f,   "ms" },
+        { Attack_High_Band,        "Attack High Band",             Kind::Float,  5.f,    500.f,   1.f,   1.f, 50.f,   "ms" },
+
+        { Release_Low_Band,        "Release Low Band",             Kind::Float,  5.f,    500.f,   1.f,   1.f, 250.f,  "ms" },
+        { Release_Mid_Band,        "Release Mid Band",             Kind::Float,  5.f,    500.f,   1.f,   1.f, 250.f,  "ms" },
+        { Release_High_Band,       "Release High Band",            Kind::Float,  5.f,    500.f,   1.f,   1.f, 250.f,  "ms" },
+
+        { Ratio_Low_Band,          "Ratio Low Band",               Kind::Choice, 0.f,    0.f,     0.f,   0.f, 3.f,    "" },
+        { Ratio_Mid_Band,          "Ratio Mid Band",               Kind::Choice, 0.f,    0.f,     0.f,   0.f, 3.f,    "" },
+        { Ratio_High_Band,         "Ratio High Band",              Kind::Choice, 0.f,    0.f,     0.f,   0.f, 3.f,    "" },
+
+        { Bypassed_Low_Band,       "Bypassed Low Band",            Kind::Bool,   0.f,    0.f,     0.f,   0.f, 0.f,    "" },
+        { Bypassed_Mid_Band,       "Bypassed Mid Band",            Kind::Bool,   0.f,    0.f,     0.f,   0.f, 0.f,    "" },
+        { Bypassed_High_Band,      "Bypassed High Band",           Kind::Bool,   0.f,    0.f,     0.f,   0.f, 0.f,    "" },
+
+        { Mute_Low_Band,           "Mute Low Band",                Kind::Bool,   0.f,    0.f,     0.f,   0.f, 0.f,    "" },
+        { Mute_Mid_Band,           "Mute Mid Band",                Kind::Bool,   0.f,    0.f,     0.f,   0.f, 0.f,    "" },
+        { Mute_High_Band,          "Mute High Band",               Kind::Bool,   0.f,    0.f,     0.f,   0.f, 0.f,    "" },
+
+        { Solo_Low_Band,           "Solo Low Band",                Kind::Bool,   0.f,    0.f,     0.f,   0.f, 0.f,    "" },
+        { Solo_Mid_Band,           "Solo Mid Band",                Kind::Bool,   0.f,    0.f,     0.f,   0.f, 0.f,    "" },
+        { Solo_High_Band,          "Solo High Band",               Kind::Bool,   0.f,    0.f,     0.f,   0.f, 0.f,    "" },
+
+        { Gain_In,                 "Gain In",                      Kind::Float,  -24.f,  24.f,    0.5f,  1.f, 0.f,    "dB" },
+        { Gain_Out,                "Gain Out",                     Kind::Float,  -24.f,  24.f,    0.5f,  1.f, 0.f,    "dB" },
+    }};
+
+    constexpr bool isIndexedByName()
+    {
+        for (size_t i = 0; i < Table.size(); ++i)
+        {
+            if (Table[i].name != (Names)i)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert(isIndexedByName(), "Params::Table must list the parameters in the order of Params::Names");
+
+    /*
+     the order the parameters are created in, and so the order hosts see them in.
+     it predates the table and must not change, or automation saved by index breaks.
+     */
+    inline constexpr std::array<Names, NumParams> HostOrder
+    {
+        Gain_In,
+        Gain_Out,
+        Threshold_Low_Band,
+        Threshold_Mid_Band,
+        Threshold_High_Band,
+        Attack_Low_Band,
+        Attack_Mid_Band,
+        Attack_High_Band,
+        Release_Low_Band,
+        Release_Mid_Band,
+        Release_High_Band,
+        Ratio_Low_Band,
+        Ratio_Mid_Band,
+        Ratio_High_Band,
+        Bypassed_Low_Band,
+        Bypassed_Mid_Band,
+        Bypassed_High_Band,
+        Low_Mid_Crossover_Freq,
+        Mid_High_Crossover_Freq,
+        Mute_Low_Band,
+        Mute_Mid_Band,
+        Mute_High_Band,
+        Solo_Low_Band,
+        Solo_Mid_Band,
+        Solo_High_Band,
     };
 
-    inline const std::map<Names, juce::String>& GetParams()
+    /*
+     one plain value per parameter, indexed by Names: the value itself for a Float, the index
+     of the choice for a Choice, 0 or 1 for a Bool. no strings, so the audio thread can use it.
+     */
+    using Values = std::array<float, NumParams>;
+
+    inline bool isOn(float value) { return value >= 0.5f; }
+
+    /*
+     the ratio at 'index' in RatioChoices. a fractional index, as produced by a morph,
+     lands between the two neighbouring choices.
+     */
+    inline float ratioAt(float index)
+    {
+        auto clamped = juce::jlimit(0.f, float(RatioChoices.size() - 1), index);
+        auto lower = juce::jmin((size_t)clamped, RatioChoices.size() - 2);
+        auto fraction = clamped - (float)lower;
+
+        return float(RatioChoices[lower] + (RatioChoices[lower + 1] - RatioChoices[lower]) * fraction);
+    }
+
+    inline juce::String toString(std::string_view text)
     {
-        static std::map<Names, juce::String> params =
+        return juce::String::fromUTF8(text.data(), (int)text.size());
+    }
+
+    /*
+     the parameter IDs as juce::Strings, indexed by Names, built once.
+     */
+    inline const std::array<juce::String, NumParams>& GetParams()
+    {
+        static const auto params = []()
         {
-            {Low_Mid_Crossover_Freq, "Low-Mid Crossover Frequency"},
-            {Mid_High_Crossover_Freq, "Mid-High Crossover Frequency"},
-            {Threshold_Low_Band, "Threshold Low Band"},
-            {Threshold_Mid_Band, "Threshold Mid Band"},
-            {Threshold_High_Band, "Threshold High Band"},
-            {Attack_Low_Band, "Attack Low Band"},
-            {Attack_Mid_Band, "Attack Mid Band"},
-            {Attack_High_Band, "Attack High Band"},
-            {Release_Low_Band, "Release Low Band"},
-            {Release_Mid_Band, "Release Mid Band"},
-            {Release_High_Band, "Release High Band"},
-            {Ratio_Low_Band, "Ratio Low Band"},
-            {Ratio_Mid_Band, "Ratio Mid Band"},
-            {Ratio_High_Band, "Ratio High Band"},
-            {Bypassed_Low_Band, "Bypassed Low Band"},
-            {Bypassed_Mid_Band, "Bypassed Mid Band"},
-            {Bypassed_High_Band, "Bypassed High Band"},
-            {Mute_Low_Band, "Mute Low Band"},
-            {Mute_Mid_Band, "Mute Mid Band"},
-            {Mute_High_Band, "Mute High Band"},
-            {Solo_Low_Band, "Solo Low Band"},
-            {Solo_Mid_Band, "Solo Mid Band"},
-            {Solo_High_Band, "Solo High Band"},
-            {Gain_In, "Gain In"},
-            {Gain_Out, "Gain Out"},
-        };
+            std::array<juce::String, NumParams> ids;
+            for (const auto& spec : Table)
+            {
+                ids[spec.name] = toString(spec.id);
+            }
+
+            return ids;
+        }();
 
         return params;
     }
 
+    /*
+     the typed parameters of one processor, indexed by Names.
+     resolved once, by position: the processor's parameters are in HostOrder.
+     */
+    struct Handles
+    {
+        explicit Handles(const juce::AudioProcessor& processor)
+        {
+            const auto& processorParams = processor.getParameters();
+            jassert(processorParams.size() == NumParams);
+
+            for (int i = 0; i < NumParams && i < processorParams.size(); ++i)
+            {
+                auto name = HostOrder[i];
+                auto* param = dynamic_cast<juce::RangedAudioParameter*>(processorParams[i]);
+
+                jassert(param != nullptr && param->paramID == GetParams()[name]);
+                params[name] = param;
+            }
+        }
+
+        juce::RangedAudioParameter& get(Names name) const { return *params[name]; }
+
+        juce::AudioParameterFloat& getFloat(Names name) const { return cast<juce::AudioParameterFloat>(name); }
+        juce::AudioParameterChoice& getChoice(Names name) const { return cast<juce::AudioParameterChoice>(name); }
+        juce::AudioParameterBool& getBool(Names name) const { return cast<juce::AudioParameterBool>(name); }
+
+        juce::String getUnit(Names name) const { return toString(Table[name].unit); }
+
+        void readValues(Values& values) const
+        {
+            for (int i = 0; i < NumParams; ++i)
+            {
+                values[i] = params[i]->convertFrom0to1(params[i]->getValue());
+            }
+        }
+
+        /*
+         sets every parameter to 'values'. the host and the attachments only hear about
+         the parameters that actually changed.
+         */
+        void writeValues(const Values& values) const
+        {
+            for (int i = 0; i < NumParams; ++i)
+            {
+                auto normalized = params[i]->convertTo0to1(values[i]);
+
+                if (params[i]->getValue() != normalized)
+                {
+                    params[i]->setValueNotifyingHost(normalized);
+                }
+            }
+        }
+    private:
+        std::array<juce::RangedAudioParameter*, NumParams> params{};
+
+        template<typename ParamType>
+        ParamType& cast(Names name) const
+        {
+            auto* param = dynamic_cast<ParamType*>(params[name]);
+            jassert(param != nullptr);
+            return *param;
+        }
+    };
 }
\ No newline at end of file
@@ -0,0 +1,242 @@
+/*
+  ==============================================================================
+
+    PresetBank.cpp
+    Created: 21 Oct 2026 9:14:05am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "PresetBank.h"
+#include "StateFormat.h"
+
+//==============================================================================
+juce::File PresetBank::getDefaultFile()
+{
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+        .getChildFile("SimpleMBComp")
+        .getChildFile("Presets.smbbank");
+}
+
+bool PresetBank::write(const juce::File& file, const std::vector<Preset>& presets)
+{
+    auto data = serialize(presets);
+
+    // written aside and moved into place, so a bank that is mapped somewhere never changes under it
+    juce::TemporaryFile temporary(file);
+
+    if (!temporary.getFile().replaceWithData(data.getData(), data.getSize()))
+    {
+        return false;
+    }
+
+    return temporary.overwriteTargetFileWithTemporary();
+}
+
+juce::MemoryBlock PresetBank::serialize(const std::vector<Preset>& presets)
+{
+    juce::MemoryOutputStream mos;
+
+    mos.writeInt((int)Magic);
+    mos.writeShort((short)CurrentVersion);
+    mos.writeShort(0);
+    mos.writeInt((int)presets.size());
+
+    // the names and states follow the index, in the same order
+    auto offset = (juce::uint32)(HeaderSize + IndexEntrySize * presets.size());
+
+    for (const auto& preset : presets)
+    {
+        auto nameSize = (juce::uint32)preset.name.getNumBytesAsUTF8();
+        auto stateSize = (juce::uint32)preset.state.getSize();
+
+        mos.writeInt((int)offset);
+        mos.writeInt((int)nameSize);
+        mos.writeInt((int)(offset + nameSize));
+        mos.writeInt((int)stateSize);
+
+        offset += nameSize + stateSize;
+    }
+
+    for (const auto& preset : presets)
+    {
+        mos.write(preset.name.toRawUTF8(), preset.name.getNumBytesAsUTF8());
+        mos.write(preset.state.getData(), preset.state.getSize());
+    }
+
+    return mos.getMemoryBlock();
+}
+
+bool PresetBank::open(const juce::File& file)
+{
+    auto mapped = map(file);
+    std::atomic_store(&contents, std::shared_ptr<const Contents>(mapped));
+
+    return mapped != nullptr;
+}
+
+void PresetBank::openInMemory(const std::vector<Preset>& presets)
+{
+    auto held = std::make_shared<Contents>();
+    held->memory = serialize(presets);
+    held->data = static_cast<const juce::uint8*>(held->memory.getData());
+    held->size = held->memory.getSize();
+
+    auto isBank = check(*held);
+    jassert(isBank);
+    juce::ignoreUnused(isBank);
+
+    std::atomic_store(&contents, std::shared_ptr<const Contents>(held));
+}
+
+int PresetBank::add(const Preset& preset)
+{
+    auto presets = getPresets();
+
+    auto existing = std::find_if(presets.begin(), presets.end(), [&](const auto& p) { return p.name == preset.name; });
+    auto index = (int)std::distance(presets.begin(), existing);
+
+    if (existing == presets.end())
+    {
+        presets.push_back(preset);
+    }
+    else
+    {
+        *existing = preset;
+    }
+
+    // held in memory from now on, which also lets save() replace the file this bank maps
+    openInMemory(presets);
+
+    return index;
+}
+
+bool PresetBank::save(const juce::File& file)
+{
+    if (!file.getParentDirectory().createDirectory() || !write(file, getPresets()))
+    {
+        return false;
+    }
+
+    if (auto mapped = map(file))
+    {
+        std::atomic_store(&contents, std::shared_ptr<const Contents>(mapped));
+    }
+
+    return true;
+}
+
+std::shared_ptr<PresetBank::Contents> PresetBank::map(const juce::File& file)
+{
+    if (!file.existsAsFile())
+    {
+        return nullptr;
+    }
+
+    auto mapped = std::make_shared<Contents>();
+    mapped->mappedFile = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+    mapped->data = static_cast<const juce::uint8*>(mapped->mappedFile->getData());
+    mapped->size = mapped->mappedFile->getSize();
+
+    if (!check(*mapped))
+    {
+        return nullptr;
+    }
+
+    return mapped;
+}
+
+bool PresetBank::check(Contents& bank)
+{
+    auto* bytes = bank.data;
+
+    if (bytes == nullptr || bank.size < HeaderSize)
+    {
+        return false;
+    }
+
+    if (juce::ByteOrder::littleEndianInt(bytes) != Magic
+        || juce::ByteOrder::littleEndianShort(bytes + 4) > CurrentVersion)
+    {
+        return false;
+    }
+
+    auto count = (juce::int64)juce::ByteOrder::littleEndianInt(bytes + 8);
+
+    if (HeaderSize + count * IndexEntrySize > (juce::int64)bank.size || count > std::numeric_limits<int>::max())
+    {
+        jassertfalse;
+        return false;
+    }
+
+    bank.numPresets = (int)count;
+    return true;
+}
+
+std::vector<PresetBank::Preset> PresetBank::getPresets() const
+{
+    std::vector<Preset> presets;
+
+    if (auto current = std::atomic_load(&contents))
+    {
+        for (int i = 0; i < current->numPresets; ++i)
+        {
+            auto state = current->getRange(i, 1);
+            presets.push_back({ current->getName(i), juce::MemoryBlock(state.data, (size_t)state.size) });
+        }
+    }
+
+    return presets;
+}
+
+int PresetBank::getNumPresets() const
+{
+    auto current = std::atomic_load(&contents);
+    return current != nullptr ? current->numPresets : 0;
+}
+
+juce::String PresetBank::getName(int index) const
+{
+    auto current = std::atomic_load(&contents);
+    return current != nullptr ? current->getName(index) : juce::String();
+}
+
+bool PresetBank::decode(int index, Params::Values& values) const
+{
+    auto current = std::atomic_load(&contents);
+    if (current == nullptr)
+    {
+        return false;
+    }
+
+    auto range = current->getRange(index, 1);
+    return range.data != nullptr && StateFormat::decode(range.data, range.size, values);
+}
+
+//==============================================================================
+juce::String PresetBank::Contents::getName(int index) const
+{
+    auto range = getRange(index, 0);
+    return juce::String::fromUTF8(reinterpret_cast<const char*>(range.data), range.size);
+}
+
+PresetBank::Range PresetBank::Contents::getRange(int index, int field) const
+{
+    if (!juce::isPositiveAndBelow(index, numPresets))
+    {
+        return {};
+    }
+
+    auto* entry = data + HeaderSize + index * IndexEntrySize + field * 8;
+
+    auto offset = (juce::uint64)juce::ByteOrder::littleEndianInt(entry);
+    auto rangeSize = (juce::uint64)juce::ByteOrder::littleEndianInt(entry + 4);
+
+    if (offset + rangeSize > (juce::uint64)size)
+    {
+        return {};
+    }
+
+    return { data + offset, (int)rangeSize };
+}
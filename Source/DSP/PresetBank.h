@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    PresetBank.h
+    Created: 21 Oct 2026 9:14:05am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "Params.h"
+
+//==============================================================================
+/**
+ a read-only bank of presets in one file, memory-mapped. little endian:
+
+    uint32  Magic
+    uint16  version
+    uint16  reserved, 0
+    uint32  number of presets
+    then per preset, the index:
+    uint32  name offset     uint32  name size (UTF-8, no terminator)
+    uint32  state offset    uint32  state size (a StateFormat blob)
+    then the names and states, wherever the index points.
+
+ opening only maps the file and checks the header, nothing is read per preset
+ until it is asked for, so thousands of presets cost nothing up front.
+
+ the contents are swapped whole: a decode on another thread keeps reading what it
+ started with while the message thread opens another bank or adds a preset.
+*/
+struct PresetBank
+{
+    static constexpr juce::uint32 Magic = 0x42424d53; // "SMBB" in file order
+    static constexpr juce::uint16 CurrentVersion = 1;
+
+    struct Preset
+    {
+        juce::String name;
+        juce::MemoryBlock state;
+    };
+
+    /*
+     where the plugin looks for its bank.
+     */
+    static juce::File getDefaultFile();
+
+    static bool write(const juce::File& file, const std::vector<Preset>& presets);
+
+    /*
+     maps 'file'. returns false, leaving the bank empty, when it is missing or not a bank.
+     */
+    bool open(const juce::File& file);
+
+    /*
+     holds 'presets' in memory, as if a bank of them had been opened.
+     */
+    void openInMemory(const std::vector<Preset>& presets);
+
+    /*
+     message thread: adds 'preset', or replaces the one with the same name, in memory.
+     returns its index. the others keep theirs.
+     */
+    int add(const Preset& preset);
+
+    /*
+     message thread: writes the presets to 'file' and maps it. returns false, keeping the
+     presets in memory, when it cannot be written. on Windows that includes while another
+     process or plugin instance maps the file.
+     */
+    bool save(const juce::File& file);
+
+    int getNumPresets() const;
+
+    juce::String getName(int index) const;
+
+    /*
+     thread-safe: only reads the contents the bank had when it was called.
+     */
+    bool decode(int index, Params::Values& values) const;
+private:
+    static constexpr int HeaderSize = 12;
+    static constexpr int IndexEntrySize = 16;
+
+    struct Range
+    {
+        const juce::uint8* data = nullptr;
+        int size = 0;
+    };
+
+    /*
+     a bank's bytes, either mapped or held in memory, checked.
+     */
+    struct Contents
+    {
+        std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+        juce::MemoryBlock memory;
+
+        const juce::uint8* data = nullptr;
+        size_t size = 0;
+        int numPresets = 0;
+
+        /*
+         one of the two ranges of an index entry, or an empty range if it points outside the bank.
+         */
+        Range getRange(int index, int field) const;
+        juce::String getName(int index) const;
+    };
+
+    static juce::MemoryBlock serialize(const std::vector<Preset>& presets);
+
+    /*
+     the contents of 'file', or nullptr when it is missing or not a bank.
+     */
+    static std::shared_ptr<Contents> map(const juce::File& file);
+
+    /*
+     checks the header and sets numPresets. false when 'data' is not a bank.
+     */
+    static bool check(Contents& bank);
+
+    std::vector<Preset> getPresets() const;
+
+    /*
+     read and replaced with std::atomic_load and std::atomic_store, so a reader holds
+     the contents alive for as long as it uses them.
+     */
+    std::shared_ptr<const Contents> contents;
+};
@@ -0,0 +1,71 @@
+/*
+  ==============================================================================
+
+    PresetLoader.cpp
+    Created: 21 Oct 2026 10:02:31am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "PresetLoader.h"
+
+//==============================================================================
+PresetLoader::PresetLoader(const PresetBank& presetBank, SnapshotBank& snapshotBank, const Params::Handles& handles) :
+    juce::Thread("SimpleMBComp preset loader"),
+    bank(presetBank),
+    snapshots(snapshotBank),
+    params(handles)
+{
+}
+
+PresetLoader::~PresetLoader()
+{
+    signalThreadShouldExit();
+    wakeUp.signal();
+    stopThread(1000);
+    cancelPendingUpdate();
+}
+
+void PresetLoader::load(int index)
+{
+    requested.store(index);
+
+    if (!isThreadRunning())
+    {
+        startThread();
+    }
+
+    wakeUp.signal();
+}
+
+void PresetLoader::run()
+{
+    while (!threadShouldExit())
+    {
+        auto index = requested.exchange(NoRequest);
+
+        if (index == NoRequest)
+        {
+            wakeUp.wait(-1);
+            continue;
+        }
+
+        auto& values = loaded.getWriteBuffer();
+        if (bank.decode(index, values))
+        {
+            snapshots.loadPreset(values);
+
+            loaded.publish();
+            triggerAsyncUpdate();
+        }
+    }
+}
+
+void PresetLoader::handleAsyncUpdate()
+{
+    if (loaded.acquireLatest())
+    {
+        snapshots.presetLoaded(loaded.getReadBuffer(), params);
+    }
+}
@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    PresetLoader.h
+    Created: 21 Oct 2026 10:02:31am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "PresetBank.h"
+#include "SnapshotBank.h"
+#include "TripleBuffer.h"
+
+//==============================================================================
+/**
+ decodes presets from a PresetBank on its own thread and hands them to the
+ SnapshotBank, which glides the audio thread there in one swap. the parameters are
+ set afterwards on the message thread, where the other SnapshotBank calls run.
+ the thread only starts with the first request, so instances that never change
+ preset never own one. when requests pile up only the newest one is loaded.
+*/
+struct PresetLoader : juce::Thread,
+                      private juce::AsyncUpdater
+{
+    PresetLoader(const PresetBank& bank, SnapshotBank& snapshots, const Params::Handles& params);
+    ~PresetLoader() override;
+
+    /*
+     message thread: loads preset 'index' of the bank, soon.
+     */
+    void load(int index);
+
+    void run() override;
+private:
+    static constexpr int NoRequest = -1;
+
+    void handleAsyncUpdate() override;
+
+    const PresetBank& bank;
+    SnapshotBank& snapshots;
+    const Params::Handles& params;
+
+    std::atomic<int> requested{ NoRequest };
+    juce::WaitableEvent wakeUp;
+
+    // the decoded presets, from the loader thread to the message thread
+    TripleBuffer<Params::Values> loaded;
+};
@@ -14,8 +14,8 @@
 
 enum Channel
 {
-    Right, // effectively 0
-    Left   // effectively 1
+    Left,  // effectively 0
+    Right  // effectively 1
 };
 
 template<typename BlockType>
@@ -29,9 +29,11 @@ struct SingleChannelSampleFifo
     void update(const BlockType& buffer)
     {
         jassert(prepared.get());
-        jassert(buffer.getNumChannels() > channelToUse);
+        jassert(buffer.getNumChannels() > 0);
 
-        auto* channelPtr = buffer.getReadPointer(channelToUse);
+        // a mono bus feeds both analyzer channels
+        auto channel = juce::jmin((int)channelToUse, buffer.getNumChannels() - 1);
+        auto* channelPtr = buffer.getReadPointer(channel);
 
         for (int i = 0; i < buffer.getNumSamples(); ++i)
         {
@@ -39,8 +41,15 @@ struct SingleChannelSampleFifo
         }
     }
 
+    /*
+     the analyzer may be pulling on the message thread while the host prepares, so the
+     buffers are only resized with the consumer locked out. they keep their memory when
+     'bufferSize' shrinks, and only reallocate when it grows past the largest so far.
+     */
     void prepare(int bufferSize)
     {
+        const juce::ScopedLock sl(consumerLock);
+
         prepared.set(false);
         size.set(bufferSize);
 
@@ -57,10 +66,14 @@ struct SingleChannelSampleFifo
     }
     //==============================================================================
     int genNumCompleteBuffersAvailable() const { return audioBufferFifo.getNumAvailableForReading(); }
-    bool isPrepared() const { return prepared.get() }
-    int getSize() const { return size.get() }
+    bool isPrepared() const { return prepared.get(); }
+    int getSize() const { return size.get(); }
     //==============================================================================
-    bool getAudioBuffer(BlockType& buf) { return audioBufferFifo.pull(buf); }
+    bool getAudioBuffer(BlockType& buf)
+    {
+        const juce::ScopedLock sl(consumerLock);
+        return audioBufferFifo.pull(buf);
+    }
 private:
     Channel channelToUse;
     int fifoIndex = 0;
@@ -69,6 +82,9 @@ private:
     juce::Atomic<bool> prepared = false;
     juce::Atomic<int> size = 0;
 
+    // between prepare() and the consumer only, the audio thread never takes it
+    juce::CriticalSection consumerLock;
+
     void pushNextSampleIntoFifo(float sample)
     {
         if (fifoIndex == bufferToFill.getNumSamples())
@@ -0,0 +1,222 @@
+/*
+  ==============================================================================
+
+    SnapshotBank.cpp
+    Created: 20 Oct 2026 5:02:44pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "SnapshotBank.h"
+
+//==============================================================================
+void SnapshotBank::store(int slot, const Params::Handles& params)
+{
+    jassert(juce::isPositiveAndBelow(slot, (int)NumSlots));
+
+    getHeardValues(params, slots[slot]);
+    stored[slot] = true;
+}
+
+void SnapshotBank::switchTo(int slot, const Params::Handles& params)
+{
+    if (slot == activeSlot && !morphing)
+    {
+        return;
+    }
+
+    // a morph in progress is not an edit of the active slot
+    if (!morphing)
+    {
+        store(activeSlot, params);
+    }
+
+    if (!stored[slot])
+    {
+        store(slot, params);
+    }
+
+    activeSlot = slot;
+    recall(slot, params);
+}
+
+void SnapshotBank::recall(int slot, const Params::Handles& params)
+{
+    jassert(juce::isPositiveAndBelow(slot, (int)NumSlots) && stored[slot]);
+
+    Move move;
+    move.target = slots[slot];
+    move.releaseWhenDone = true;
+
+    publish(move);
+    morphing = false;
+
+    // the audio thread already has the whole move, this only tells the host
+    params.writeValues(slots[slot]);
+}
+
+void SnapshotBank::morph(int from, int to, float position, const Params::Handles& params)
+{
+    for (auto slot : { from, to })
+    {
+        if (!stored[slot])
+        {
+            store(slot, params);
+        }
+    }
+
+    position = juce::jlimit(0.f, 1.f, position);
+
+    Move move;
+    for (int i = 0; i < Params::NumParams; ++i)
+    {
+        move.target[i] = slots[from][i] + (slots[to][i] - slots[from][i]) * position;
+    }
+
+    publish(move);
+    morphing = true;
+}
+
+void SnapshotBank::commitMorph(const Params::Handles& params)
+{
+    if (!morphing)
+    {
+        return;
+    }
+
+    Move move;
+    move.target = lastMove.target;
+    move.releaseWhenDone = true;
+
+    // the parameters can only hold whole choices and plain switches
+    for (const auto& spec : Params::Table)
+    {
+        if (spec.kind != Params::Kind::Float)
+        {
+            move.target[spec.name] = std::round(move.target[spec.name]);
+        }
+    }
+
+    publish(move);
+    morphing = false;
+
+    params.writeValues(move.target);
+}
+
+void SnapshotBank::presetLoaded(const Params::Values& values, const Params::Handles& params)
+{
+    Move move;
+    move.target = values;
+    move.releaseWhenDone = true;
+
+    // the preset again, ordered after any move made since loadPreset(): whichever of those
+    // the audio thread picked, it ends on the settings the parameters are about to get
+    publish(move);
+    morphing = false;
+
+    params.writeValues(values);
+}
+
+//==============================================================================
+void SnapshotBank::loadPreset(const Params::Values& values)
+{
+    auto& move = presetMoves.getWriteBuffer();
+    move.target = values;
+    move.releaseWhenDone = true;
+    move.order = nextOrder.fetch_add(1);
+
+    presetMoves.publish();
+}
+
+//==============================================================================
+void SnapshotBank::prepare(double sampleRate, const Params::Handles& params)
+{
+    glideSamples = juce::jmax(1, juce::roundToInt(sampleRate * GlideSeconds));
+
+    if (!following)
+    {
+        params.readValues(current);
+    }
+}
+
+void SnapshotBank::getBlockValues(const Params::Handles& params, Params::Values& values, int numSamples)
+{
+    const Move* next = nullptr;
+
+    if (moves.acquireLatest())
+    {
+        next = &moves.getReadBuffer();
+    }
+
+    // when both threads moved since the last block, the later move is the one to play
+    if (presetMoves.acquireLatest())
+    {
+        const auto& presetMove = presetMoves.getReadBuffer();
+
+        if (next == nullptr || (juce::int32)(presetMove.order - next->order) > 0)
+        {
+            next = &presetMove;
+        }
+    }
+
+    if (next != nullptr)
+    {
+        // the glide starts from what the last block ran with, never from the parameters:
+        // the message thread may already have written the target to them
+        playing = next;
+        samplesLeft = glideSamples;
+        following = true;
+    }
+
+    if (!following)
+    {
+        params.readValues(current);
+        values = current;
+        return;
+    }
+
+    const auto& move = *playing;
+
+    if (samplesLeft > 0)
+    {
+        // one step per block, reaching the target when the glide runs out
+        auto fraction = juce::jmin(1.f, (float)numSamples / (float)samplesLeft);
+
+        for (int i = 0; i < Params::NumParams; ++i)
+        {
+            current[i] += (move.target[i] - current[i]) * fraction;
+        }
+
+        samplesLeft -= numSamples;
+    }
+
+    values = current;
+
+    if (move.releaseWhenDone && samplesLeft <= 0)
+    {
+        // the parameters hold the target by now
+        following = false;
+    }
+}
+
+//==============================================================================
+void SnapshotBank::publish(const Move& move)
+{
+    lastMove = move;
+    lastMove.order = nextOrder.fetch_add(1);
+
+    moves.getWriteBuffer() = lastMove;
+    moves.publish();
+}
+
+void SnapshotBank::getHeardValues(const Params::Handles& params, Params::Values& values) const
+{
+    if (morphing)
+    {
+        values = lastMove.target;
+        return;
+    }
+
+    params.readValues(values);
+}
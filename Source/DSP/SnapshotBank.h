@@ -0,0 +1,138 @@
+/*
+  ==============================================================================
+
+    SnapshotBank.h
+    Created: 20 Oct 2026 5:02:44pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "Params.h"
+#include "TripleBuffer.h"
+
+//==============================================================================
+/**
+ in-memory snapshots of every parameter, as flat Params::Values: A, B and a small bank.
+
+ switching to a snapshot or morphing between two of them never goes through the
+ parameters one by one. the message thread hands the target values to the audio thread
+ in one TripleBuffer swap, and the audio thread glides every value there over 'GlideSeconds':
+ floats move smoothly, the ratio goes through the choices in between and the switches
+ flip halfway. the parameters only catch up once a move is settled, so the host sees
+ one update per parameter instead of a stream of them.
+*/
+struct SnapshotBank
+{
+    enum Slots
+    {
+        A,
+        B,
+        // the rest is the bank
+        NumSlots = 8
+    };
+
+    static constexpr double GlideSeconds = 0.05;
+
+    //==============================================================================
+    // message thread
+
+    void store(int slot, const Params::Handles& params);
+    bool isStored(int slot) const { return stored[slot]; }
+
+    /*
+     A/B comparison: the current settings are kept in the active slot, then 'slot' is
+     recalled and becomes the active one. an empty slot starts as a copy of the current settings.
+     */
+    void switchTo(int slot, const Params::Handles& params);
+    int getActiveSlot() const { return activeSlot; }
+
+    /*
+     glides from what is heard now to 'slot' and sets the parameters to it.
+     */
+    void recall(int slot, const Params::Handles& params);
+
+    /*
+     plays the blend of 'from' and 'to' at 'position' (0 is 'from'), leaving the
+     parameters alone until commitMorph(). empty slots get the current settings first.
+     */
+    void morph(int from, int to, float position, const Params::Handles& params);
+
+    /*
+     ends a morph: the parameters are set to the blend, with the ratio on the nearest
+     choice and the switches on or off, and the audio thread follows them again.
+     */
+    void commitMorph(const Params::Handles& params);
+
+    /*
+     the second half of loadPreset(): sets the parameters to the preset and ends any morph.
+     a move made in between is heard until this one, which glides back to the preset.
+     */
+    void presetLoaded(const Params::Values& values, const Params::Handles& params);
+
+    //==============================================================================
+    // preset thread
+
+    /*
+     glides the audio thread to 'values'. presets have a hand-off of their own, so this
+     may run at the same time as the message thread calls. it touches nothing else: the
+     parameters follow once presetLoaded() runs on the message thread.
+     */
+    void loadPreset(const Params::Values& values);
+
+    //==============================================================================
+    // audio thread
+
+    /*
+     a move that arrives before the first block glides from the parameters as they are here.
+     */
+    void prepare(double sampleRate, const Params::Handles& params);
+
+    /*
+     the values to run this block with: the parameters, or the move in progress. of a
+     preset and another move arriving in the same block, the one made last is played.
+     */
+    void getBlockValues(const Params::Handles& params, Params::Values& values, int numSamples);
+private:
+    struct Move
+    {
+        Params::Values target{};
+
+        // hand back to the parameters once 'target' is reached
+        bool releaseWhenDone = false;
+
+        // when the move was made, from 'nextOrder', to pick the later of two moves made
+        // by different threads
+        juce::uint32 order = 0;
+    };
+
+    void publish(const Move& move);
+
+    /*
+     what the audio thread plays once the last move settled.
+     */
+    void getHeardValues(const Params::Handles& params, Params::Values& values) const;
+
+    // message thread only
+    std::array<Params::Values, NumSlots> slots{};
+    std::array<bool, NumSlots> stored{};
+    int activeSlot = A;
+    Move lastMove;
+    bool morphing = false;
+
+    TripleBuffer<Move> moves;
+    TripleBuffer<Move> presetMoves;
+
+    // message and preset threads
+    std::atomic<juce::uint32> nextOrder{ 0 };
+
+    // audio thread only
+    const Move* playing = nullptr;
+    // the values the last block ran with, where the next glide starts
+    Params::Values current{};
+    int glideSamples = 1;
+    int samplesLeft = 0;
+    bool following = false;
+};
@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+    StageProfiler.cpp
+    Created: 22 Oct 2026 4:37:05pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "StageProfiler.h"
+
+namespace Profiling
+{
+    const char* getStageName(Stage stage)
+    {
+        switch (stage)
+        {
+            case Stage::UpdateState: return "updateState";
+            case Stage::InputGain: return "inputGain";
+            case Stage::AnalyzerTap: return "analyzerTap";
+            case Stage::SplitBands: return "splitBands";
+            case Stage::LowBand: return "lowBand";
+            case Stage::MidBand: return "midBand";
+            case Stage::HighBand: return "highBand";
+            case Stage::MixBands: return "mixBands";
+            case Stage::OutputGain: return "outputGain";
+            case Stage::Block: return "processBlock";
+            case Stage::NumStages: break;
+        }
+
+        jassertfalse;
+        return "";
+    }
+
+#if SIMPLEMBCOMP_PROFILING
+    //==============================================================================
+    namespace
+    {
+        std::atomic<int> numInstances{ 0 };
+    }
+
+    StageProfiler::StageProfiler() :
+        juce::Thread("SimpleMBComp trace writer"),
+        instance(++numInstances)
+    {
+    }
+
+    StageProfiler::~StageProfiler()
+    {
+        stopRecording();
+    }
+
+    bool StageProfiler::startRecording(const juce::File& traceFile)
+    {
+        stopRecording();
+
+        traceFile.getParentDirectory().createDirectory();
+
+        auto stream = std::make_unique<juce::FileOutputStream>(traceFile);
+
+        if (!stream->openedOk() || !stream->setPosition(0) || !stream->truncate().wasOk())
+        {
+            return false;
+        }
+
+        // the cycle counter against the high resolution clock, over a few milliseconds
+        auto startTicks = juce::Time::getHighResolutionTicks();
+        auto cycles = now();
+        juce::Thread::sleep(10);
+        auto elapsedTicks = juce::Time::getHighResolutionTicks() - startTicks;
+        auto elapsedCycles = now() - cycles;
+
+        auto elapsedMicroseconds = juce::Time::highResolutionTicksToSeconds(elapsedTicks) * 1.0e6;
+        cyclesPerMicrosecond = juce::jmax(1.0e-3, double(elapsedCycles) / elapsedMicroseconds);
+
+        trace = std::move(stream);
+        startCycles = now();
+        dropped.store(0);
+
+        *trace << "{\"traceEvents\":[\n"
+               << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << instance
+               << ",\"args\":{\"name\":\"SimpleMBComp #" << instance << " audio\"}}";
+
+        // whatever the audio thread left from an earlier trace is skipped
+        read.store(written.load(std::memory_order_acquire), std::memory_order_release);
+        recording.store(true);
+
+        startThread();
+        return true;
+    }
+
+    void StageProfiler::stopRecording()
+    {
+        if (trace == nullptr)
+        {
+            return;
+        }
+
+        recording.store(false);
+        signalThreadShouldExit();
+        notify();
+        stopThread(1000);
+
+        drain();
+
+        *trace << "\n],\"otherData\":{\"droppedEvents\":\"" << (int)dropped.load() << "\"}}\n";
+        trace->flush();
+        trace.reset();
+    }
+
+    void StageProfiler::run()
+    {
+        while (!threadShouldExit())
+        {
+            wait(DrainIntervalMs);
+            drain();
+        }
+    }
+
+    void StageProfiler::drain()
+    {
+        auto end = written.load(std::memory_order_acquire);
+        auto position = read.load(std::memory_order_relaxed);
+
+        // complete events, microseconds since the trace started
+        auto toMicroseconds = [this](juce::uint64 cycles)
+        {
+            return double(juce::int64(cycles - startCycles)) / cyclesPerMicrosecond;
+        };
+
+        for (; position < end; ++position)
+        {
+            auto event = events[position % Capacity];
+
+            *trace << ",\n{\"name\":\"" << getStageName(event.stage)
+                   << "\",\"cat\":\"audio\",\"ph\":\"X\",\"pid\":1,\"tid\":" << instance
+                   << ",\"ts\":" << juce::String(toMicroseconds(event.begin), 3)
+                   << ",\"dur\":" << juce::String(double(event.end - event.begin) / cyclesPerMicrosecond, 3)
+                   << ",\"args\":{\"block\":" << (juce::int64)event.block << "}}";
+
+            // the slot can be reused as soon as it was copied
+            read.store(position + 1, std::memory_order_release);
+        }
+
+        trace->flush();
+    }
+#endif
+}
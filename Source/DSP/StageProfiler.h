@@ -0,0 +1,180 @@
+/*
+  ==============================================================================
+
+    StageProfiler.h
+    Created: 22 Oct 2026 4:37:05pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+#ifndef SIMPLEMBCOMP_PROFILING
+ #define SIMPLEMBCOMP_PROFILING 0
+#endif
+
+#if SIMPLEMBCOMP_PROFILING && JUCE_INTEL && (JUCE_GCC || JUCE_CLANG)
+ #include <x86intrin.h>
+#elif SIMPLEMBCOMP_PROFILING && JUCE_INTEL && JUCE_MSVC
+ #include <intrin.h>
+#endif
+
+//==============================================================================
+/*
+ where processBlock spends its time, stage by stage, as a Chrome/Perfetto trace.
+
+ built with SIMPLEMBCOMP_PROFILING=1 only. processBlock then asks isRecording() once per
+ block and takes the instrumented path only while a trace is being written, so an idle
+ profiler costs that one branch. the stages go through a NoTimer otherwise, which
+ compiles to nothing.
+*/
+namespace Profiling
+{
+    enum class Stage : juce::uint8
+    {
+        UpdateState,
+        InputGain,
+        AnalyzerTap,
+        SplitBands,
+        LowBand,
+        MidBand,
+        HighBand,
+        MixBands,
+        OutputGain,
+        // the whole of processBlock, the others nest in it
+        Block,
+        NumStages
+    };
+
+    inline Stage bandStage(size_t band) { return Stage(size_t(Stage::LowBand) + band); }
+
+    const char* getStageName(Stage stage);
+
+    struct NoTimer
+    {
+        void lap(Stage) noexcept {}
+    };
+
+#if SIMPLEMBCOMP_PROFILING
+    //==============================================================================
+    /**
+     one per processor instance. the audio thread writes a fixed size event per stage into
+     a single producer / single consumer ring, it never allocates, locks or waits: when the
+     ring is full the event is dropped and counted. while recording, a background thread
+     drains the ring every 'DrainIntervalMs' and appends the events to the trace file.
+     the timestamps are CPU cycles (rdtsc on x86), calibrated when recording starts.
+    */
+    struct StageProfiler : juce::Thread
+    {
+        StageProfiler();
+        ~StageProfiler() override;
+
+        //==============================================================================
+        // message thread
+
+        /*
+         starts a new trace in 'traceFile', replacing it. returns false when it can't be written.
+         */
+        bool startRecording(const juce::File& traceFile);
+
+        /*
+         writes what is left and closes the trace. does nothing when not recording.
+         */
+        void stopRecording();
+
+        //==============================================================================
+        // audio thread
+
+        bool isRecording() const noexcept { return recording.load(std::memory_order_relaxed); }
+
+        static juce::uint64 now() noexcept
+        {
+           #if JUCE_INTEL && (JUCE_GCC || JUCE_CLANG || JUCE_MSVC)
+            return __rdtsc();
+           #else
+            return (juce::uint64)juce::Time::getHighResolutionTicks();
+           #endif
+        }
+
+        /*
+         times the stages of one block: each lap() closes the stage that started at
+         the previous one, and the whole block is recorded when the timer goes away.
+         */
+        struct Timer
+        {
+            explicit Timer(StageProfiler& p) noexcept :
+                profiler(p),
+                block(p.blockCounter++),
+                blockStart(now()),
+                last(blockStart)
+            {
+            }
+
+            ~Timer() { profiler.record(Stage::Block, blockStart, last, block); }
+
+            void lap(Stage stage) noexcept
+            {
+                auto time = now();
+                profiler.record(stage, last, time, block);
+                last = time;
+            }
+        private:
+            StageProfiler& profiler;
+            juce::uint32 block;
+            juce::uint64 blockStart, last;
+
+            JUCE_DECLARE_NON_COPYABLE(Timer)
+        };
+
+        void run() override;
+    private:
+        static constexpr int Capacity = 1 << 14;
+        static constexpr int DrainIntervalMs = 50;
+
+        struct Event
+        {
+            juce::uint64 begin = 0;
+            juce::uint64 end = 0;
+            juce::uint32 block = 0;
+            Stage stage = Stage::Block;
+        };
+
+        void record(Stage stage, juce::uint64 begin, juce::uint64 end, juce::uint32 block) noexcept
+        {
+            auto position = written.load(std::memory_order_relaxed);
+
+            if (position - read.load(std::memory_order_acquire) >= (juce::uint64)Capacity)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            events[position % Capacity] = { begin, end, block, stage };
+            written.store(position + 1, std::memory_order_release);
+        }
+
+        void drain();
+
+        std::array<Event, Capacity> events;
+        std::atomic<juce::uint64> written{ 0 };
+        std::atomic<juce::uint64> read{ 0 };
+        std::atomic<juce::uint32> dropped{ 0 };
+        std::atomic<bool> recording{ false };
+
+        // audio thread only
+        juce::uint32 blockCounter = 0;
+
+        // the trace, owned by the message thread while stopped and by the drain thread while recording
+        std::unique_ptr<juce::FileOutputStream> trace;
+        juce::uint64 startCycles = 0;
+        double cyclesPerMicrosecond = 1.0;
+
+        // each instance gets its own track in the trace
+        const int instance;
+
+        JUCE_DECLARE_NON_COPYABLE(StageProfiler)
+    };
+#endif
+}
@@ -0,0 +1,108 @@
+/*
+  ==============================================================================
+
+    StateFormat.cpp
+    Created: 20 Oct 2026 3:48:26pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "StateFormat.h"
+
+namespace
+{
+    /*
+     converts a value stored by an older schema to the current one.
+     version 1 is the first binary schema, nothing to convert yet.
+     */
+    float migrate(juce::uint16 version, Params::Names name, float value)
+    {
+        juce::ignoreUnused(version, name);
+        return value;
+    }
+}
+
+//==============================================================================
+void StateFormat::write(const Params::Handles& params, juce::MemoryBlock& destData)
+{
+    Params::Values values;
+    params.readValues(values);
+
+    write(values, destData);
+}
+
+void StateFormat::write(const Params::Values& values, juce::MemoryBlock& destData)
+{
+    juce::MemoryOutputStream mos(destData, true);
+
+    mos.writeInt((int)Magic);
+    mos.writeShort((short)CurrentVersion);
+    mos.writeShort((short)Params::NumParams);
+
+    for (int i = 0; i < Params::NumParams; ++i)
+    {
+        mos.writeByte((char)i);
+        mos.writeFloat(values[i]);
+    }
+}
+
+bool StateFormat::decode(const void* data, int sizeInBytes, Params::Values& values)
+{
+    if (data == nullptr || sizeInBytes < HeaderSize)
+    {
+        return false;
+    }
+
+    auto* bytes = static_cast<const juce::uint8*>(data);
+
+    if (juce::ByteOrder::littleEndianInt(bytes) != Magic)
+    {
+        return false;
+    }
+
+    auto version = juce::ByteOrder::littleEndianShort(bytes + 4);
+    auto numEntries = (int)juce::ByteOrder::littleEndianShort(bytes + 6);
+
+    if (sizeInBytes < HeaderSize + numEntries * EntrySize)
+    {
+        jassertfalse;
+        return false;
+    }
+
+    // a state is complete: whatever the blob does not mention goes back to its default
+    for (const auto& spec : Params::Table)
+    {
+        values[spec.name] = spec.defaultValue;
+    }
+
+    auto* entry = bytes + HeaderSize;
+    for (int i = 0; i < numEntries; ++i, entry += EntrySize)
+    {
+        auto index = (int)entry[0];
+        if (index >= Params::NumParams)
+        {
+            continue;
+        }
+
+        float value;
+        auto bits = juce::ByteOrder::littleEndianInt(entry + 1);
+        std::memcpy(&value, &bits, sizeof(value));
+
+        values[index] = migrate(version, (Params::Names)index, value);
+    }
+
+    return true;
+}
+
+bool StateFormat::read(const Params::Handles& params, const void* data, int sizeInBytes)
+{
+    Params::Values values;
+    if (!decode(data, sizeInBytes, values))
+    {
+        return false;
+    }
+
+    params.writeValues(values);
+    return true;
+}
@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    StateFormat.h
+    Created: 20 Oct 2026 3:48:26pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "Params.h"
+
+//==============================================================================
+/**
+ the plugin state as a compact binary blob, little endian:
+
+    uint32  Magic
+    uint16  schema version
+    uint16  number of entries
+    then per entry:
+    uint8   parameter index (a Params::Names value)
+    float32 plain value (the choice index for choice parameters)
+
+ the indices are the Names values, so new parameters must be appended to Names,
+ never inserted. unknown indices are skipped and missing ones get their default,
+ so older and newer blobs both load. the version is bumped when the meaning of a
+ stored value changes; migrate() in StateFormat.cpp converts the old values.
+*/
+namespace StateFormat
+{
+    // "SMBC" in file order
+    inline constexpr juce::uint32 Magic = 0x43424d53;
+    inline constexpr juce::uint16 CurrentVersion = 1;
+
+    inline constexpr int HeaderSize = 8;
+    inline constexpr int EntrySize = 5;
+
+    void write(const Params::Handles& params, juce::MemoryBlock& destData);
+    void write(const Params::Values& values, juce::MemoryBlock& destData);
+
+    /*
+     the values 'data' holds, without touching any parameter. returns false when
+     'data' is not a binary state or is truncated.
+     */
+    bool decode(const void* data, int sizeInBytes, Params::Values& values);
+
+    /*
+     restores every parameter in one pass. returns false, without touching anything,
+     when 'data' is not a binary state or is truncated: the caller then tries the
+     ValueTree format older versions wrote.
+     */
+    bool read(const Params::Handles& params, const void* data, int sizeInBytes);
+}
@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    TripleBuffer.h
+    Created: 19 Oct 2026 9:41:26am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ lock-free, single producer / single consumer hand-off of the latest value.
+ the producer always has a slot to write into, the consumer always reads the
+ newest published slot, and older values are simply overwritten: nothing queues up.
+*/
+template<typename T>
+struct TripleBuffer
+{
+    /*
+     producer side: fill this, then publish() it.
+     */
+    T& getWriteBuffer() { return buffers[writeIndex]; }
+
+    void publish()
+    {
+        writeIndex = middle.exchange(writeIndex | NewDataFlag, std::memory_order_acq_rel) & IndexMask;
+    }
+
+    /*
+     consumer side: returns true if a newer value was swapped into the read slot.
+     */
+    bool acquireLatest()
+    {
+        if ((middle.load(std::memory_order_relaxed) & NewDataFlag) == 0)
+        {
+            return false;
+        }
+
+        readIndex = middle.exchange(readIndex, std::memory_order_acq_rel) & IndexMask;
+        return true;
+    }
+
+    const T& getReadBuffer() const { return buffers[readIndex]; }
+
+    /*
+     only call this while neither side is running, e.g. to preallocate every slot.
+     */
+    template<typename Fn>
+    void forEachBuffer(Fn&& fn)
+    {
+        for (auto& buffer : buffers)
+        {
+            fn(buffer);
+        }
+    }
+private:
+    static constexpr int IndexMask = 3;
+    static constexpr int NewDataFlag = 4;
+
+    std::array<T, 3> buffers;
+    int writeIndex = 0;
+    int readIndex = 1;
+    std::atomic<int> middle{ 2 };
+};
@@ -10,16 +10,19 @@
 
 #pragma once
 #include <JuceHeader.h>
-#include "../DSP/Fifo.h"
+#include "../DSP/TripleBuffer.h"
 #include "Utilities.h"
 
 template<typename PathType>
 struct AnalyzerPathGenerator
 {
     /*
-     converts 'renderData[]' into a juce::Path
+     converts 'renderData[]' into a juce::Path reduced to the min/max envelope of each
+     pixel column: at most 2 vertices per column, whatever the FFT size.
+     returns false, and publishes nothing, when no vertex would move by half a pixel or more
+     from the last published path. slow traces still get there, a few frames at a time.
      */
-    void generatePath(const std::vector<float>& renderData,
+    bool generatePath(const std::vector<float>& renderData,
         juce::Rectangle<float> fftBounds,
         int fftSize,
         float binWidth,
@@ -29,10 +32,7 @@ struct AnalyzerPathGenerator
         auto bottom = fftBounds.getBottom();
         auto width = fftBounds.getWidth();
 
-        int numBins = (int)fftSize / 2;
-
-        PathType p;
-        p.preallocateSpace(3 * (int)fftBounds.getWidth());
+        auto mappingChanged = updateColumnMapping((int)width, fftSize, binWidth);
 
         auto map = [bottom, top, negativeInfinity](float v)
         {
@@ -41,43 +41,196 @@ struct AnalyzerPathGenerator
                 bottom, top);
         };
 
-        auto y = map(renderData[0]);
+        auto changed = mappingChanged;
+
+        // renderData is already sanitized by FFTDataGenerator, no NaN/inf can reach this point
+        for (size_t x = 0; x < columns.size(); ++x)
+        {
+            const auto& column = columns[x];
+            const auto* bins = renderData.data() + column.firstBin;
+
+            float highest, lowest;
+            if (column.numBins > 0)
+            {
+                auto range = std::minmax_element(bins, bins + column.numBins);
+                lowest = *range.first;
+                highest = *range.second;
+            }
+            else
+            {
+                highest = lowest = bins[0] + column.fraction * (bins[1] - bins[0]);
+            }
+
+            auto& envelope = envelopes[x];
+            envelope.top = map(highest);
+            envelope.bottom = map(lowest);
+
+            const auto& shown = publishedEnvelopes[x];
+
+            changed = changed
+                || std::abs(envelope.top - shown.top) >= 0.5f
+                || std::abs(envelope.bottom - shown.bottom) >= 0.5f;
+        }
 
-        //        jassert( !std::isnan(y) && !std::isinf(y) );
-        if (std::isnan(y) || std::isinf(y))
-            y = bottom;
+        if (!changed)
+        {
+            return false;
+        }
 
-        p.startNewSubPath(0, y);
+        publishedEnvelopes = envelopes;
 
-        const int pathResolution = 2; //you can draw line-to's every 'pathResolution' pixels.
+        // built in place in the free slot: clear() keeps the storage of previous frames,
+        // so once every slot went through one frame at this width nothing gets allocated
+        auto& p = paths.getWriteBuffer();
+        p.clear();
+        p.preallocateSpace(3 * 2 * (int)envelopes.size());
 
-        for (int binNum = 1; binNum < numBins; binNum += pathResolution)
+        auto lastY = 0.f;
+        for (size_t x = 0; x < envelopes.size(); ++x)
         {
-            y = map(renderData[binNum]);
+            const auto& envelope = envelopes[x];
+            const auto fx = (float)x;
 
-            //            jassert( !std::isnan(y) && !std::isinf(y) );
+            // a column flatter than half a pixel needs one vertex only
+            if (envelope.bottom - envelope.top < 0.5f)
+            {
+                lastY = envelope.top;
+
+                if (x == 0)
+                {
+                    p.startNewSubPath(fx, lastY);
+                }
+                else
+                {
+                    p.lineTo(fx, lastY);
+                }
+
+                continue;
+            }
 
-            if (!std::isnan(y) && !std::isinf(y))
+            // visit the extreme nearer to the previous vertex first, so the trace
+            // does not cross the whole column twice
+            auto first = envelope.top;
+            auto second = envelope.bottom;
+            if (std::abs(lastY - second) < std::abs(lastY - first))
             {
-                auto binFreq = binNum * binWidth;
-                auto normalizedBinX = juce::mapFromLog10(binFreq, MIN_FREQUENCY, MAX_FREQUENCY);
-                int binX = std::floor(normalizedBinX * width);
-                p.lineTo(binX, y);
+                std::swap(first, second);
             }
+
+            if (x == 0)
+            {
+                p.startNewSubPath(fx, first);
+            }
+            else
+            {
+                p.lineTo(fx, first);
+            }
+
+            p.lineTo(fx, second);
+            lastY = second;
         }
 
-        pathFifo.push(p);
+        paths.publish();
+        return true;
     }
 
-    int getNumPathsAvailable() const
+    /*
+     swaps in the newest generated path, if there is one. returns false when
+     getPath() is already up to date.
+     */
+    bool pullLatestPath() { return paths.acquireLatest(); }
+
+    const PathType& getPath() const { return paths.getReadBuffer(); }
+private:
+    TripleBuffer<PathType> paths;
+
+    /*
+     the bins that land on one pixel column.
+     when 'numBins' is 0 the column falls between two bins, and the level is
+     interpolated between 'firstBin' and 'firstBin + 1' by 'fraction'.
+     */
+    struct ColumnBins
     {
-        return pathFifo.getNumAvailableForReading();
-    }
+        int firstBin = 0;
+        int numBins = 0;
+        float fraction = 0.f;
+    };
+
+    std::vector<ColumnBins> columns;
 
-    bool getPath(PathType& path)
+    /*
+     the highest and lowest point of the trace within one pixel column, in pixels.
+     */
+    struct ColumnEnvelope
     {
-        return pathFifo.pull(path);
+        float top = 0.f;
+        float bottom = 0.f;
+    };
+
+    std::vector<ColumnEnvelope> envelopes;
+
+    // what the last published path was built from, the reference for the next one
+    std::vector<ColumnEnvelope> publishedEnvelopes;
+
+    int mappedWidth = 0;
+    int mappedFFTSize = 0;
+    float mappedBinWidth = 0.f;
+
+    /*
+     rebuilds the pixel-to-bin table, only when the width, FFT size or sample rate changed.
+     returns true when it did.
+     */
+    bool updateColumnMapping(int width, int fftSize, float binWidth)
+    {
+        if (width == mappedWidth && fftSize == mappedFFTSize && binWidth == mappedBinWidth)
+        {
+            return false;
+        }
+
+        mappedWidth = width;
+        mappedFFTSize = fftSize;
+        mappedBinWidth = binWidth;
+
+        columns.resize(juce::jmax(0, width));
+        envelopes.resize(columns.size());
+        publishedEnvelopes.resize(columns.size());
+
+        const int lastBin = fftSize / 2 - 1;
+
+        auto binPosition = [width, binWidth](float x)
+        {
+            auto frequency = juce::mapToLog10(x / (float)width, MIN_FREQUENCY, MAX_FREQUENCY);
+            return frequency / binWidth;
+        };
+
+        for (int x = 0; x < width; ++x)
+        {
+            auto& column = columns[x];
+
+            // bins whose position lies in [start, end) belong to this column
+            auto start = binPosition((float)x);
+            auto end = binPosition((float)(x + 1));
+
+            auto first = juce::jlimit(0, lastBin, (int)std::ceil(start));
+            auto last = juce::jlimit(0, lastBin, (int)std::ceil(end) - 1);
+
+            if (last >= first)
+            {
+                column.firstBin = first;
+                column.numBins = last - first + 1;
+                column.fraction = 0.f;
+            }
+            else
+            {
+                auto centre = juce::jlimit(0.f, (float)lastBin, binPosition(x + 0.5f));
+                auto lower = juce::jmin((int)centre, lastBin - 1);
+
+                column.firstBin = lower;
+                column.numBins = 0;
+                column.fraction = centre - (float)lower;
+            }
+        }
+
+        return true;
     }
-private:
-    Fifo<PathType> pathFifo;
 };
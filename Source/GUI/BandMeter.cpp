@@ -0,0 +1,94 @@
+/*
+  ==============================================================================
+
+    BandMeter.cpp
+    Created: 20 Oct 2026 10:21:38am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "BandMeter.h"
+#include "Utilities.h"
+
+//==============================================================================
+void BandMeter::update(const BandTelemetry::Levels& levels)
+{
+    auto now = juce::Time::getMillisecondCounterHiRes();
+    auto elapsed = lastUpdateMs > 0.0 ? float((now - lastUpdateMs) * 0.001) : 0.f;
+    lastUpdateMs = now;
+
+    const auto fall = FallRate * elapsed;
+
+    auto next = displayed;
+
+    // levels jump up at once and fall back slowly, gain reduction the other way round
+    next.inputPeak = juce::jmax(levels.inputPeak, displayed.inputPeak - fall);
+    next.inputRms = juce::jmax(levels.inputRms, displayed.inputRms - fall);
+    next.outputPeak = juce::jmax(levels.outputPeak, displayed.outputPeak - fall);
+    next.outputRms = juce::jmax(levels.outputRms, displayed.outputRms - fall);
+    next.gainReduction = juce::jmin(levels.gainReduction, displayed.gainReduction + fall);
+
+    auto moved = [](float a, float b) { return std::abs(a - b) >= 0.1f; };
+
+    auto changed = moved(next.inputPeak, displayed.inputPeak)
+        || moved(next.inputRms, displayed.inputRms)
+        || moved(next.outputPeak, displayed.outputPeak)
+        || moved(next.outputRms, displayed.outputRms)
+        || moved(next.gainReduction, displayed.gainReduction);
+
+    if (changed)
+    {
+        displayed = next;
+        repaint();
+    }
+}
+
+void BandMeter::reset()
+{
+    displayed = BandTelemetry::Levels();
+    lastUpdateMs = 0.0;
+    repaint();
+}
+
+void BandMeter::paint(juce::Graphics& g)
+{
+    using namespace juce;
+
+    auto bounds = getLocalBounds().toFloat();
+
+    const auto barWidth = (bounds.getWidth() - 4.f) / 3.f;
+    auto inputBar = bounds.removeFromLeft(barWidth);
+    bounds.removeFromLeft(2.f);
+    auto outputBar = bounds.removeFromLeft(barWidth);
+    bounds.removeFromLeft(2.f);
+    auto gainReductionBar = bounds;
+
+    auto mapY = [top = inputBar.getY(), bottom = inputBar.getBottom()](float db)
+    {
+        return jmap(jlimit(NEGATIVE_INFINITY, MAX_DECIBELS, db), NEGATIVE_INFINITY, MAX_DECIBELS, bottom, top);
+    };
+
+    auto drawLevel = [&g, &mapY](Rectangle<float> bar, float rms, float peak)
+    {
+        g.setColour(Colours::black);
+        g.fillRect(bar);
+
+        g.setColour(Colour(0u, 172u, 1u));
+        g.fillRect(bar.withTop(mapY(rms)));
+
+        g.setColour(peak > 0.f ? Colours::red : Colours::white);
+        g.fillRect(bar.withTop(mapY(peak)).withHeight(1.f));
+    };
+
+    drawLevel(inputBar, displayed.inputRms, displayed.inputPeak);
+    drawLevel(outputBar, displayed.outputRms, displayed.outputPeak);
+
+    // gain reduction hangs from the top
+    g.setColour(Colours::black);
+    g.fillRect(gainReductionBar);
+
+    auto reduction = jlimit(0.f, 1.f, displayed.gainReduction / MaxGainReduction);
+    g.setColour(Colour(255u, 154u, 1u));
+    g.fillRect(gainReductionBar.withHeight(gainReductionBar.getHeight() * reduction));
+}
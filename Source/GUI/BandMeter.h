@@ -0,0 +1,39 @@
+/*
+  ==============================================================================
+
+    BandMeter.h
+    Created: 20 Oct 2026 10:21:38am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "../DSP/BandTelemetry.h"
+
+//==============================================================================
+/**
+ input level, output level and gain reduction of one compressor band, as three bars.
+ the levels are RMS with a peak tick, and everything falls back at 'FallRate' dB/s.
+*/
+struct BandMeter : juce::Component
+{
+    /*
+     feeds the latest telemetry. repaints only when a bar moved visibly.
+     */
+    void update(const BandTelemetry::Levels& levels);
+
+    /*
+     drops the displayed levels, for instance when another band gets shown.
+     */
+    void reset();
+
+    void paint(juce::Graphics& g) override;
+private:
+    static constexpr float FallRate = 24.f;
+    static constexpr float MaxGainReduction = -24.f;
+
+    BandTelemetry::Levels displayed;
+    double lastUpdateMs = 0.0;
+};
@@ -12,8 +12,8 @@
 #include "Utilities.h"
 
 //==============================================================================
-CompressorBandControls::CompressorBandControls(juce::AudioProcessorValueTreeState& apv) :
-    apvts(apv),
+CompressorBandControls::CompressorBandControls(const SimpleMBCompAudioProcessor& processor) :
+    audioProcessor(processor),
     attackSlider(nullptr, "ms", "ATTACK"),
     releaseSlider(nullptr, "ms", "RELEASE"),
     thresholdSlider(nullptr, "dB", "THRESH"),
@@ -23,6 +23,7 @@ CompressorBandControls::CompressorBandControls(juce::AudioProcessorValueTreeStat
     addAndMakeVisible(releaseSlider);
     addAndMakeVisible(thresholdSlider);
     addAndMakeVisible(ratioSlider);
+    addAndMakeVisible(meter);
 
     bypassButton.addListener(this);
     soloButton.addListener(this);
@@ -111,11 +112,9 @@ void CompressorBandControls::updateBandSelectButtonState()
         {Names::Solo_High_Band, Names::Mute_High_Band, Names::Bypassed_High_Band},
     };
 
-    const auto& params = GetParams();
-
-    auto ParamHelper = [&params, this](const auto& name)
+    auto ParamHelper = [&parameters = audioProcessor.parameters](const auto& name)
     {
-        return dynamic_cast<juce::AudioParameterBool*>(&getParam(apvts, params, name));
+        return &parameters.getBool(name);
     };
 
     for (size_t i = 0; i < ParamsToCheck.size(); ++i)
@@ -256,6 +255,8 @@ void CompressorBandControls::resized()
     flexBox.items.add(spacer);
     flexBox.items.add(FlexItem(ratioSlider).withFlex(1.f));
     flexBox.items.add(spacer);
+    flexBox.items.add(FlexItem(meter).withWidth(30).withMargin(FlexItem::Margin(4, 0, 4, 0)));
+    flexBox.items.add(spacer);
 
     flexBox.items.add(FlexItem(bandButtonControlBox).withWidth(30));
 
@@ -351,11 +352,9 @@ void CompressorBandControls::updateAttachments()
         Bypass
     };
 
-    const auto& params = GetParams();
-
-    auto getParamHelper = [&params, &apvts = this->apvts, &names](const auto& pos) -> auto&
+    auto getParamHelper = [&parameters = audioProcessor.parameters, &names](const auto& pos) -> auto&
     {
-        return getParam(apvts, params, names.at(pos));
+        return parameters.get(names.at(pos));
     };
 
     attackSliderAttachment.reset();
@@ -375,7 +374,7 @@ void CompressorBandControls::updateAttachments()
     releaseSlider.changeParam(&releaseParam);
 
     auto& thresholdParam = getParamHelper(Pos::Threshold);
-    addLabelPairs(thresholdSlider.labels, thresholdParam, "ms");
+    addLabelPairs(thresholdSlider.labels, thresholdParam, "dB");
     thresholdSlider.changeParam(&thresholdParam);
 
     auto& ratioParamRap = getParamHelper(Pos::Ratio);
@@ -386,16 +385,25 @@ void CompressorBandControls::updateAttachments()
         juce::String(ratioParam->choices.getReference(ratioParam->choices.size() - 1).getIntValue()) + ":1" });
     ratioSlider.changeParam(ratioParam);
 
-    auto makeAtachmentHelper = [&params, &apvts = this->apvts](auto& attachment, const auto& name, auto& slider)
+    auto makeAtachmentHelper = [&getParamHelper](auto& attachment, const auto& pos, auto& slider)
     {
-        makeAttachment(attachment, apvts, params, name, slider);
+        makeAttachment(attachment, getParamHelper(pos), slider);
     };
 
-    makeAtachmentHelper(attackSliderAttachment, names[Pos::Attack], attackSlider);
-    makeAtachmentHelper(releaseSliderAttachment, names[Pos::Release], releaseSlider);
-    makeAtachmentHelper(thresholdSliderAttachment, names[Pos::Threshold], thresholdSlider);
-    makeAtachmentHelper(ratioSliderAttachment, names[Pos::Ratio], ratioSlider);
-    makeAtachmentHelper(bypassButtonAttachment, names[Pos::Bypass], bypassButton);
-    makeAtachmentHelper(soloButtonAttachment, names[Pos::Solo], soloButton);
-    makeAtachmentHelper(muteButtonAttachment, names[Pos::Mute], muteButton);
+    makeAtachmentHelper(attackSliderAttachment, Pos::Attack, attackSlider);
+    makeAtachmentHelper(releaseSliderAttachment, Pos::Release, releaseSlider);
+    makeAtachmentHelper(thresholdSliderAttachment, Pos::Threshold, thresholdSlider);
+    makeAtachmentHelper(ratioSliderAttachment, Pos::Ratio, ratioSlider);
+    makeAtachmentHelper(bypassButtonAttachment, Pos::Bypass, bypassButton);
+    makeAtachmentHelper(soloButtonAttachment, Pos::Solo, soloButton);
+    makeAtachmentHelper(muteButtonAttachment, Pos::Mute, muteButton);
+
+    meter.reset();
+}
+
+int CompressorBandControls::getActiveBandIndex() const
+{
+    return activeBand == &lowBand ? 0 :
+           activeBand == &midBand ? 1 :
+           2;
 }
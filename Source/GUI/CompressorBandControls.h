@@ -12,13 +12,15 @@
 #include <JuceHeader.h>
 #include "../DSP/Params.h"
 #include "RotarySliderWithLabels.h"
+#include "BandMeter.h"
+#include "../PluginProcessor.h"
 
 //==============================================================================
 /**
 */
 struct CompressorBandControls : juce::Component, juce::Button::Listener
 {
-    CompressorBandControls(juce::AudioProcessorValueTreeState& apvts);
+    CompressorBandControls(const SimpleMBCompAudioProcessor& processor);
     ~CompressorBandControls() override;
 
     void paint(juce::Graphics& g) override;
@@ -28,19 +30,19 @@ struct CompressorBandControls : juce::Component, juce::Button::Listener
     void buttonClicked(juce::Button* button) override;
 
 private:
-    juce::AudioProcessorValueTreeState& apvts;
+    const SimpleMBCompAudioProcessor& audioProcessor;
 
     using RSWL = RotarySliderWithLabels;
     RSWL attackSlider, releaseSlider, thresholdSlider;
 
     RatioSlider ratioSlider;
 
-    using Attachment = juce::AudioProcessorValueTreeState::SliderAttachment;
+    using Attachment = juce::SliderParameterAttachment;
     std::unique_ptr<Attachment> attackSliderAttachment, releaseSliderAttachment, thresholdSliderAttachment, ratioSliderAttachment;
 
     juce::ToggleButton bypassButton, soloButton, muteButton, lowBand, midBand, highBand;
 
-    using BtnAttachment = juce::AudioProcessorValueTreeState::ButtonAttachment;
+    using BtnAttachment = juce::ButtonParameterAttachment;
     std::unique_ptr<BtnAttachment> bypassButtonAttachment, soloButtonAttachment, muteButtonAttachment;
 
     juce::Component::SafePointer<CompressorBandControls> safePtr{ this };
@@ -60,4 +62,13 @@ private:
     static void refreshBandButtonColors(juce::Button& band, juce::Button& colorSource);
 
     void updateBandSelectButtonState();
+
+    /*
+     the meter shows the selected band, refreshed once per display frame.
+     */
+    BandMeter meter;
+
+    int getActiveBandIndex() const;
+
+    juce::VBlankAttachment vBlankAttachment{ this, [this] { meter.update(audioProcessor.getBandTelemetry(getActiveBandIndex()).read()); } };
 };
@@ -0,0 +1,139 @@
+/*
+  ==============================================================================
+
+    ControlBar.cpp
+    Created: 18 Oct 2026 11:20:37am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "ControlBar.h"
+
+//==============================================================================
+ControlBar::ControlBar()
+{
+    analyzerEnableButton.setToggleState(true, juce::NotificationType::dontSendNotification);
+    addAndMakeVisible(analyzerEnableButton);
+
+    // item ids are the FFTOrder values, so the selection maps straight back
+    fftOrderSelector.addItem("2048", FFTOrder::order2048);
+    fftOrderSelector.addItem("4096", FFTOrder::order4096);
+    fftOrderSelector.addItem("8192", FFTOrder::order8192);
+    fftOrderSelector.addItem("Multi", MultiResolutionId);
+    fftOrderSelector.setSelectedId(FFTOrder::order2048, juce::NotificationType::dontSendNotification);
+    fftOrderSelector.setTooltip("Analyzer resolution");
+    addAndMakeVisible(fftOrderSelector);
+
+    // combo box ids cannot be 0, so these are offset by one from the OctaveSmoothing values
+    smoothingSelector.addItem("Raw", OctaveSmoothing::noSmoothing + 1);
+    smoothingSelector.addItem("1/3 oct", OctaveSmoothing::thirdOctave + 1);
+    smoothingSelector.addItem("1/6 oct", OctaveSmoothing::sixthOctave + 1);
+    smoothingSelector.addItem("1/12 oct", OctaveSmoothing::twelfthOctave + 1);
+    smoothingSelector.addItem("1/24 oct", OctaveSmoothing::twentyFourthOctave + 1);
+    smoothingSelector.setSelectedId(OctaveSmoothing::noSmoothing + 1, juce::NotificationType::dontSendNotification);
+    smoothingSelector.setTooltip("Analyzer smoothing");
+    addAndMakeVisible(smoothingSelector);
+
+    analyzerTapSelector.addItem("Pre", TapIds::PreCompressionTap);
+    analyzerTapSelector.addItem("Post", TapIds::PostCompressionTap);
+    analyzerTapSelector.setSelectedId(TapIds::PostCompressionTap, juce::NotificationType::dontSendNotification);
+    analyzerTapSelector.setTooltip("Analyze the signal before or after compression");
+    addAndMakeVisible(analyzerTapSelector);
+
+    bandOverlayButton.setName("BANDS");
+    bandOverlayButton.setColour(juce::TextButton::ColourIds::buttonOnColourId, juce::Colours::grey);
+    bandOverlayButton.setColour(juce::TextButton::ColourIds::buttonColourId, juce::Colours::black);
+    bandOverlayButton.setTooltip("Show each band's share of the spectrum");
+    addAndMakeVisible(bandOverlayButton);
+
+    waterfallButton.setName("WATERFALL");
+    waterfallButton.setColour(juce::TextButton::ColourIds::buttonOnColourId, juce::Colours::grey);
+    waterfallButton.setColour(juce::TextButton::ColourIds::buttonColourId, juce::Colours::black);
+    waterfallButton.setTooltip("Show the spectrum over time");
+    addAndMakeVisible(waterfallButton);
+
+    gainReductionHistoryButton.setName("GR");
+    gainReductionHistoryButton.setColour(juce::TextButton::ColourIds::buttonOnColourId, juce::Colours::grey);
+    gainReductionHistoryButton.setColour(juce::TextButton::ColourIds::buttonColourId, juce::Colours::black);
+    gainReductionHistoryButton.setTooltip("Show each band's gain reduction over the last seconds");
+    addAndMakeVisible(gainReductionHistoryButton);
+
+    for (auto* button : { &snapshotAButton, &snapshotBButton })
+    {
+        button->setClickingTogglesState(true);
+        button->setRadioGroupId(1);
+        button->setColour(juce::TextButton::ColourIds::buttonOnColourId, juce::Colours::grey);
+        button->setColour(juce::TextButton::ColourIds::buttonColourId, juce::Colours::black);
+        addAndMakeVisible(*button);
+    }
+
+    snapshotAButton.setToggleState(true, juce::NotificationType::dontSendNotification);
+    snapshotAButton.setTooltip("Snapshot A, the current settings are kept in the selected snapshot");
+    snapshotBButton.setTooltip("Snapshot B, the current settings are kept in the selected snapshot");
+
+    morphSlider.setRange(0.0, 1.0);
+    morphSlider.setScrollWheelEnabled(false);
+    morphSlider.setTooltip("Morph between snapshots A and B");
+    addAndMakeVisible(morphSlider);
+
+    savePresetButton.setColour(juce::TextButton::ColourIds::buttonColourId, juce::Colours::black);
+    savePresetButton.setTooltip("Save the current settings as a preset");
+    addAndMakeVisible(savePresetButton);
+}
+
+void ControlBar::resized()
+{
+    auto bounds = getLocalBounds();
+
+    analyzerEnableButton.setBounds(bounds.removeFromLeft(50).reduced(0, 4));
+
+    bounds.removeFromLeft(4);
+
+    fftOrderSelector.setBounds(bounds.removeFromLeft(64).reduced(0, 5));
+
+    bounds.removeFromLeft(4);
+
+    smoothingSelector.setBounds(bounds.removeFromLeft(72).reduced(0, 5));
+
+    bounds.removeFromLeft(4);
+
+    analyzerTapSelector.setBounds(bounds.removeFromLeft(56).reduced(0, 5));
+
+    bounds.removeFromLeft(4);
+
+    bandOverlayButton.setBounds(bounds.removeFromLeft(60).reduced(0, 4));
+
+    bounds.removeFromLeft(4);
+
+    waterfallButton.setBounds(bounds.removeFromLeft(80).reduced(0, 4));
+
+    bounds.removeFromLeft(4);
+
+    gainReductionHistoryButton.setBounds(bounds.removeFromLeft(40).reduced(0, 4));
+
+    bounds.removeFromLeft(8);
+
+    savePresetButton.setBounds(bounds.removeFromRight(40).reduced(0, 4));
+
+    bounds.removeFromRight(8);
+
+    snapshotAButton.setBounds(bounds.removeFromLeft(24).reduced(0, 4));
+    snapshotBButton.setBounds(bounds.removeFromRight(24).reduced(0, 4));
+    morphSlider.setBounds(bounds.reduced(2, 4));
+}
+
+FFTOrder ControlBar::getSelectedFFTOrder() const
+{
+    return static_cast<FFTOrder>(fftOrderSelector.getSelectedId());
+}
+
+bool ControlBar::isMultiResolutionSelected() const
+{
+    return fftOrderSelector.getSelectedId() == MultiResolutionId;
+}
+
+OctaveSmoothing ControlBar::getSelectedSmoothing() const
+{
+    return static_cast<OctaveSmoothing>(smoothingSelector.getSelectedId() - 1);
+}
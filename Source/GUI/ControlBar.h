@@ -0,0 +1,56 @@
+/*
+  ==============================================================================
+
+    ControlBar.h
+    Created: 18 Oct 2026 11:20:37am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "CustomButtons.h"
+#include "Utilities.h"
+
+//==============================================================================
+/**
+*/
+struct ControlBar : juce::Component
+{
+    ControlBar();
+
+    void resized() override;
+
+    /*
+     only meaningful when isMultiResolutionSelected() is false.
+     */
+    FFTOrder getSelectedFFTOrder() const;
+    bool isMultiResolutionSelected() const;
+    OctaveSmoothing getSelectedSmoothing() const;
+
+    // shares fftOrderSelector with the FFTOrder ids, which start at 11
+    static constexpr int MultiResolutionId = 1;
+
+    enum TapIds
+    {
+        PreCompressionTap = 1,
+        PostCompressionTap
+    };
+
+    analyzerButton analyzerEnableButton;
+    juce::ComboBox fftOrderSelector;
+    juce::ComboBox smoothingSelector;
+    juce::ComboBox analyzerTapSelector;
+    juce::ToggleButton bandOverlayButton;
+    juce::ToggleButton waterfallButton;
+    juce::ToggleButton gainReductionHistoryButton;
+
+    // A/B snapshots, and the morph between them
+    juce::TextButton snapshotAButton{ "A" };
+    juce::TextButton snapshotBButton{ "B" };
+    juce::Slider morphSlider{ juce::Slider::SliderStyle::LinearHorizontal, juce::Slider::TextEntryBoxPosition::NoTextBox };
+
+    // saves the current settings as a preset of the user's bank
+    juce::TextButton savePresetButton{ "SAVE" };
+};
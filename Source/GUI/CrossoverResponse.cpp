@@ -0,0 +1,71 @@
+/*
+  ==============================================================================
+
+    CrossoverResponse.cpp
+    Created: 19 Oct 2026 11:18:03am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "CrossoverResponse.h"
+
+//==============================================================================
+void CrossoverResponse::prepare(int maxNumBins)
+{
+    for (auto& response : responses)
+    {
+        response.resize(maxNumBins, 0.f);
+    }
+}
+
+bool CrossoverResponse::update(float lowMidFrequency, float midHighFrequency, int fftSize, double sampleRate)
+{
+    if (lowMidFrequency == lowMid && midHighFrequency == midHigh && fftSize == size && sampleRate == rate)
+    {
+        return false;
+    }
+
+    lowMid = lowMidFrequency;
+    midHigh = midHighFrequency;
+    size = fftSize;
+    rate = sampleRate;
+
+    const int numBins = juce::jmin(fftSize / 2, (int)responses[Low].size());
+
+    // the TPT filters follow the bilinear transform, so compare prewarped frequencies
+    auto warp = [sampleRate](double frequency)
+    {
+        frequency = juce::jmin(frequency, sampleRate * 0.499);
+        return std::tan(juce::MathConstants<double>::pi * frequency / sampleRate);
+    };
+
+    const auto lowMidWarped = warp(lowMidFrequency);
+    const auto midHighWarped = warp(midHighFrequency);
+
+    auto toDecibels = [](double gain)
+    {
+        return juce::Decibels::gainToDecibels((float)gain, -200.f);
+    };
+
+    for (int i = 0; i < numBins; ++i)
+    {
+        auto warped = warp(i * sampleRate / fftSize);
+
+        // 4th order Linkwitz-Riley: |LP| = 1 / (1 + r^4), |HP| = r^4 / (1 + r^4)
+        auto r0 = std::pow(warped / lowMidWarped, 4.0);
+        auto r1 = std::pow(warped / midHighWarped, 4.0);
+
+        auto lp0 = 1.0 / (1.0 + r0);
+        auto hp0 = r0 / (1.0 + r0);
+        auto lp1 = 1.0 / (1.0 + r1);
+        auto hp1 = r1 / (1.0 + r1);
+
+        // low: LP1 -> AP2, mid: HP1 -> LP2, high: HP1 -> HP2. the allpass has unity gain.
+        responses[Low][i] = toDecibels(lp0);
+        responses[Mid][i] = toDecibels(hp0 * lp1);
+        responses[High][i] = toDecibels(hp0 * hp1);
+    }
+
+    return true;
+}
@@ -0,0 +1,46 @@
+/*
+  ==============================================================================
+
+    CrossoverResponse.h
+    Created: 19 Oct 2026 11:18:03am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ magnitude response of each band of the Linkwitz-Riley crossover, in dB per FFT bin.
+ computed analytically, so the analyzer can show every band's share of the
+ spectrum from the one input FFT instead of analyzing 'filterBuffers'.
+*/
+struct CrossoverResponse
+{
+    enum Band
+    {
+        Low,
+        Mid,
+        High,
+        NumBands
+    };
+
+    void prepare(int maxNumBins);
+
+    /*
+     recomputes the responses if anything changed since the last call.
+     returns true when it did.
+     */
+    bool update(float lowMidFrequency, float midHighFrequency, int fftSize, double sampleRate);
+
+    const std::vector<float>& getResponse(Band band) const { return responses[band]; }
+private:
+    std::array<std::vector<float>, NumBands> responses;
+
+    float lowMid = 0.f;
+    float midHigh = 0.f;
+    int size = 0;
+    double rate = 0.0;
+};
@@ -11,81 +11,119 @@
 #pragma once
 #include <JuceHeader.h>
 #include "Utilities.h"
+#include "SpectrumKernels.h"
+#include "OctaveSmoother.h"
+#include "../DSP/AnalysisRingBuffer.h"
 
 template<typename BlockType>
 struct FFTDataGenerator
 {
     /**
-     produces the FFT data from an audio buffer.
+     produces the FFT data from the newest 'fftSize' samples of the ring buffer.
      */
-    void produceFFTDataForRendering(const juce::AudioBuffer<float>& audioData, const float negativeInfinity)
+    void produceFFTDataForRendering(const AnalysisRingBuffer& ringBuffer, const float negativeInfinity)
     {
         const auto fftSize = getFFTSize();
 
-        fftData.assign(fftData.size(), 0);
-        auto* readIndex = audioData.getReadPointer(0);
-        std::copy(readIndex, readIndex + fftSize, fftData.begin());
-
-        // first apply a windowing function to our data
-        window->multiplyWithWindowingTable(fftData.data(), fftSize);       // [1]
+        // first unwrap the ring into fftData, applying the window on the way
+        ringBuffer.readWindowed(fftData.data(), currentPlan->windowTable.data(), fftSize);   // [1]
 
         // then render our FFT data..
-        forwardFFT->performFrequencyOnlyForwardTransform(fftData.data());  // [2]
+        currentPlan->forwardFFT->performFrequencyOnlyForwardTransform(fftData.data());  // [2]
 
         int numBins = (int)fftSize / 2;
 
-        //normalize the fft values.
-        for (int i = 0; i < numBins; ++i)
-        {
-            auto v = fftData[i];
-            //            fftData[i] /= (float) numBins;
-            if (!std::isinf(v) && !std::isnan(v))
-            {
-                v /= float(numBins);
-            }
-            else
-            {
-                v = 0.f;
-            }
-            fftData[i] = v;
-        }
+        // fractional-octave smoothing works on the magnitudes, before they become dB
+        smoother.configure(requestedSmoothing.load(), numBins);
+        smoother.process(fftData.data(), numBins);
 
-        //convert them to decibels
-        for (int i = 0; i < numBins; ++i)
+        // normalize the fft values and convert them to decibels, in one pass
+        magnitudesToDecibels(fftData.data(), numBins, 1.f / (float)numBins, negativeInfinity);  // [3]
+    }
+
+    /*
+     the FFT plans and windows for every FFTOrder are built once, up front,
+     and the frame storage is sized for the largest order.
+     switching resolution afterwards never allocates.
+     */
+    FFTDataGenerator()
+    {
+        for (int i = 0; i < NumOrders; ++i)
         {
-            fftData[i] = juce::Decibels::gainToDecibels(fftData[i], negativeInfinity);
+            auto planOrder = FFTOrder::order2048 + i;
+            auto planSize = 1 << planOrder;
+
+            auto& plan = plans[i];
+            plan.forwardFFT = std::make_unique<juce::dsp::FFT>(planOrder);
+
+            plan.windowTable.resize(planSize, 0);
+            juce::dsp::WindowingFunction<float>::fillWindowingTables(plan.windowTable.data(),
+                                                                     (size_t)planSize,
+                                                                     juce::dsp::WindowingFunction<float>::blackmanHarris);
         }
 
-        fftDataFifo.push(fftData);
+        fftData.resize(getMaxFFTSize() * 2, 0);
+        smoother.prepare(getMaxFFTSize() / 2);
+
+        currentPlan = &plans[order - FFTOrder::order2048];
     }
 
+    /*
+     requests a new resolution. safe to call from any thread, the switch itself
+     happens between two frames, in applyPendingOrder().
+     */
     void changeOrder(FFTOrder newOrder)
     {
-        //when you change order, recreate the window, forwardFFT, fifo, fftData
-        //also reset the fifoIndex
-        //things that need recreating should be created on the heap via std::make_unique<>
-
-        order = newOrder;
-        auto fftSize = getFFTSize();
+        requestedOrder.store(newOrder);
+    }
 
-        forwardFFT = std::make_unique<juce::dsp::FFT>(order);
-        window = std::make_unique<juce::dsp::WindowingFunction<float>>(fftSize, juce::dsp::WindowingFunction<float>::blackmanHarris);
+    /*
+     swaps in the requested plan, if any. returns true when the order changed.
+     */
+    bool applyPendingOrder()
+    {
+        auto newOrder = requestedOrder.load();
+        if (newOrder == order)
+        {
+            return false;
+        }
 
-        fftData.clear();
-        fftData.resize(fftSize * 2, 0);
+        order = newOrder;
+        currentPlan = &plans[order - FFTOrder::order2048];
 
-        fftDataFifo.prepare(fftData.size());
+        return true;
+    }
+    /*
+     requests a smoothing width, picked up at the next frame. safe to call from any thread.
+     */
+    void setSmoothing(OctaveSmoothing newSmoothing)
+    {
+        requestedSmoothing.store(newSmoothing);
     }
     //==============================================================================
     int getFFTSize() const { return 1 << order; }
-    int getNumAvailableFFTDataBlocks() const { return fftDataFifo.getNumAvailableForReading(); }
+    static constexpr int getMaxFFTSize() { return 1 << FFTOrder::order8192; }
     //==============================================================================
-    bool getFFTData(BlockType& fftData) { return fftDataFifo.pull(fftData); }
+    /*
+     the dB values of the last frame produced, valid for the first getFFTSize() / 2 bins.
+     */
+    const BlockType& getFFTData() const { return fftData; }
 private:
-    FFTOrder order;
+    static constexpr int NumOrders = FFTOrder::order8192 - FFTOrder::order2048 + 1;
+
+    struct Plan
+    {
+        std::unique_ptr<juce::dsp::FFT> forwardFFT;
+        std::vector<float> windowTable;
+    };
+
+    std::array<Plan, NumOrders> plans;
+    Plan* currentPlan{ nullptr };
+
+    FFTOrder order{ FFTOrder::order2048 };
+    std::atomic<FFTOrder> requestedOrder{ FFTOrder::order2048 };
     BlockType fftData;
-    std::unique_ptr<juce::dsp::FFT> forwardFFT;
-    std::unique_ptr<juce::dsp::WindowingFunction<float>> window;
 
-    Fifo<BlockType> fftDataFifo;
+    OctaveSmoother smoother;
+    std::atomic<OctaveSmoothing> requestedSmoothing{ OctaveSmoothing::noSmoothing };
 };
\ No newline at end of file
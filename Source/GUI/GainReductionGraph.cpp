@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    GainReductionGraph.cpp
+    Created: 20 Oct 2026 2:05:17pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "GainReductionGraph.h"
+
+//==============================================================================
+GainReductionGraph::GainReductionGraph()
+{
+    // same colours as the band overlay of the analyzer
+    bandColours[0] = juce::Colours::cyan.getPixelARGB();
+    bandColours[1] = juce::Colours::limegreen.getPixelARGB();
+    bandColours[2] = juce::Colours::hotpink.getPixelARGB();
+}
+
+void GainReductionGraph::prepare(int width, int height, const SimpleMBCompAudioProcessor& processor)
+{
+    image.prepare(width, height, juce::Colours::transparentBlack);
+
+    for (int band = 0; band < NumBands; ++band)
+    {
+        readPositions[band] = processor.getGainReductionHistory(band).getNumWritten();
+    }
+}
+
+bool GainReductionGraph::update(const SimpleMBCompAudioProcessor& processor)
+{
+    if (image.isEmpty())
+    {
+        return false;
+    }
+
+    // the bands complete their columns in the same block, but the audio thread may be between
+    // two of them right now: only the columns every band already has are taken
+    juce::int64 numNew = std::numeric_limits<juce::int64>::max();
+
+    for (int band = 0; band < NumBands; ++band)
+    {
+        const auto& history = processor.getGainReductionHistory(band);
+        auto written = history.getNumWritten();
+
+        // skip what was overwritten, and what would scroll out of the image anyway
+        auto oldestUseful = written - juce::jmin(GainReductionHistory::Capacity, image.getWidth());
+        readPositions[band] = juce::jmax(readPositions[band], oldestUseful);
+
+        numNew = juce::jmin(numNew, written - readPositions[band]);
+    }
+
+    if (numNew <= 0)
+    {
+        return false;
+    }
+
+    const auto height = image.getHeight();
+    auto toPixel = [height](float gainReduction)
+    {
+        auto normalized = juce::jlimit(0.f, 1.f, gainReduction / MaxGainReduction);
+        return juce::jmin(height - 1, int(normalized * (height - 1) + 0.5f));
+    };
+
+    for (juce::int64 i = 0; i < numNew; ++i)
+    {
+        image.pushColumn([this, &processor, &toPixel](juce::Image::BitmapData& column)
+        {
+            for (int y = 0; y < column.height; ++y)
+            {
+                *reinterpret_cast<juce::PixelARGB*>(column.getLinePointer(y)) = juce::PixelARGB(0, 0, 0, 0);
+            }
+
+            for (int band = 0; band < NumBands; ++band)
+            {
+                auto value = processor.getGainReductionHistory(band).getColumn(readPositions[band]++);
+
+                // the least reduction is the highest point, the most is the lowest
+                auto top = toPixel(value.maximum);
+                auto bottom = toPixel(value.minimum);
+
+                for (int y = top; y <= bottom; ++y)
+                {
+                    *reinterpret_cast<juce::PixelARGB*>(column.getLinePointer(y)) = bandColours[band];
+                }
+            }
+        });
+    }
+
+    return true;
+}
@@ -0,0 +1,46 @@
+/*
+  ==============================================================================
+
+    GainReductionGraph.h
+    Created: 20 Oct 2026 2:05:17pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "ScrollingImage.h"
+#include "../PluginProcessor.h"
+
+//==============================================================================
+/**
+ the gain reduction history of every band, one trace per band, scrolling right to left.
+ only the columns completed since the last update get rendered, into a ScrollingImage,
+ so the cost of a frame does not depend on the width of the graph.
+*/
+struct GainReductionGraph
+{
+    GainReductionGraph();
+
+    /*
+     one column per pixel, 'height' pixels covering 0 to 'MaxGainReduction' dB.
+     starts from the newest columns, the backlog is not replayed.
+     */
+    void prepare(int width, int height, const SimpleMBCompAudioProcessor& processor);
+
+    /*
+     renders the columns completed since the last call. returns true when there were any.
+     */
+    bool update(const SimpleMBCompAudioProcessor& processor);
+
+    void draw(juce::Graphics& g, juce::Rectangle<int> area) const { image.draw(g, area); }
+private:
+    static constexpr float MaxGainReduction = -24.f;
+    static constexpr int NumBands = SimpleMBCompAudioProcessor::NumBands;
+
+    ScrollingImage image;
+
+    std::array<juce::int64, NumBands> readPositions{};
+    std::array<juce::PixelARGB, NumBands> bandColours;
+};
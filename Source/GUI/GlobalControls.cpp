@@ -12,35 +12,24 @@
 #include "Utilities.h"
 
 //==============================================================================
-GlobalControls::GlobalControls(juce::AudioProcessorValueTreeState& apvts)
+GlobalControls::GlobalControls(const Params::Handles& parameters)
 {
     using namespace Params;
-    const auto& params = GetParams();
 
-    auto getParamHelper = [&params, &apvts](const auto& name) -> auto&
-    {
-        return getParam(apvts, params, name);
-    };
-
-    auto& gainInParam = getParamHelper(Names::Gain_In);
-    auto& lowMidXoverParam = getParamHelper(Names::Low_Mid_Crossover_Freq);
-    auto& midHighXoverParam = getParamHelper(Names::Mid_High_Crossover_Freq);
-    auto& gainOutParam = getParamHelper(Names::Gain_Out);
+    auto& gainInParam = parameters.get(Names::Gain_In);
+    auto& lowMidXoverParam = parameters.get(Names::Low_Mid_Crossover_Freq);
+    auto& midHighXoverParam = parameters.get(Names::Mid_High_Crossover_Freq);
+    auto& gainOutParam = parameters.get(Names::Gain_Out);
 
     inGainSlider = std::make_unique<RSWL>(&gainInParam, "dB", "INPUT TRIM");
     lowMidXoverSlider = std::make_unique<RSWL>(&lowMidXoverParam, "Hz", "LOW MID X-OVER");
     midHighXoverSlider = std::make_unique<RSWL>(&midHighXoverParam, "Hz", "LOW MID X-OVER");
     outGainSlider = std::make_unique<RSWL>(&gainOutParam, "dB", "OUTPUT TRIM");
 
-    auto makeAtachmentHelper = [&params, &apvts](auto& attachment, const auto& name, auto& slider)
-    {
-        makeAttachment(attachment, apvts, params, name, slider);
-    };
-
-    makeAtachmentHelper(inGainSliderAttachment, Names::Gain_In, *inGainSlider);
-    makeAtachmentHelper(lowMidXoverSliderAttachment, Names::Low_Mid_Crossover_Freq, *lowMidXoverSlider);
-    makeAtachmentHelper(midHighXoverSliderAttachment, Names::Mid_High_Crossover_Freq, *midHighXoverSlider);
-    makeAtachmentHelper(outGainSliderAttachment, Names::Gain_Out, *outGainSlider);
+    makeAttachment(inGainSliderAttachment, gainInParam, *inGainSlider);
+    makeAttachment(lowMidXoverSliderAttachment, lowMidXoverParam, *lowMidXoverSlider);
+    makeAttachment(midHighXoverSliderAttachment, midHighXoverParam, *midHighXoverSlider);
+    makeAttachment(outGainSliderAttachment, gainOutParam, *outGainSlider);
 
     addLabelPairs(inGainSlider->labels, gainInParam, "dB");
     addLabelPairs(lowMidXoverSlider->labels, lowMidXoverParam, "Hz");
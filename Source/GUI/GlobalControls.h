@@ -18,7 +18,7 @@
 */
 struct GlobalControls : juce::Component
 {
-    GlobalControls(juce::AudioProcessorValueTreeState& apvts);
+    GlobalControls(const Params::Handles& parameters);
 
     void paint(juce::Graphics& g) override;
 
@@ -28,6 +28,6 @@ private:
     using RSWL = RotarySliderWithLabels;
     std::unique_ptr<RSWL> inGainSlider, lowMidXoverSlider, midHighXoverSlider, outGainSlider;
 
-    using Attachment = juce::AudioProcessorValueTreeState::SliderAttachment;
+    using Attachment = juce::SliderParameterAttachment;
     std::unique_ptr< Attachment> inGainSliderAttachment, lowMidXoverSliderAttachment, midHighXoverSliderAttachment, outGainSliderAttachment;
 };
\ No newline at end of file
@@ -0,0 +1,152 @@
+/*
+  ==============================================================================
+
+    MultiResolutionAnalyzer.cpp
+    Created: 19 Oct 2026 5:52:14pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "MultiResolutionAnalyzer.h"
+
+//==============================================================================
+MultiResolutionAnalyzer::MultiResolutionAnalyzer()
+{
+    const auto stageSize = getStageFFTSize();
+    const auto maxDecimation = 1 << (NumStages - 1);
+    const auto numBins = getStitchedFFTSize() / 2;
+
+    windowTable.resize(stageSize, 0.f);
+    juce::dsp::WindowingFunction<float>::fillWindowingTables(windowTable.data(),
+                                                             (size_t)stageSize,
+                                                             juce::dsp::WindowingFunction<float>::blackmanHarris);
+
+    stageData.resize(stageSize * 2, 0.f);
+
+    for (auto& chunk : chunks)
+    {
+        chunk.resize(ChunkSize / 2 + 1, 0.f);
+    }
+
+    for (int s = 0; s < NumStages; ++s)
+    {
+        auto& stage = stages[s];
+        stage.decimation = 1 << s;
+        stage.ringBuffer.prepare(stageSize);
+
+        // every decimated stage is read up to a quarter of its own sample rate,
+        // the band its half-band filters leave free of aliasing. the full rate stage goes up to Nyquist.
+        stage.endBin = s == 0 ? numBins : getStitchedFFTSize() / (4 * stage.decimation);
+    }
+
+    for (int s = 0; s < NumStages; ++s)
+    {
+        stages[s].firstBin = s + 1 < NumStages ? stages[s + 1].endBin : 0;
+    }
+
+    jassert(stages[NumStages - 1].decimation == maxDecimation);
+
+    stitchedMagnitudes.resize(numBins, 0.f);
+    fftData.resize(numBins, 0.f);
+    smoother.prepare(numBins);
+}
+
+void MultiResolutionAnalyzer::reset()
+{
+    for (auto& stage : stages)
+    {
+        stage.decimator.reset();
+        stage.ringBuffer.prepare(getStageFFTSize());
+        stage.samplesSinceLastFrame = 0;
+    }
+
+    std::fill(stitchedMagnitudes.begin(), stitchedMagnitudes.end(), 0.f);
+}
+
+void MultiResolutionAnalyzer::push(const float* samples, int numSamples)
+{
+    while (numSamples > 0)
+    {
+        const auto chunkSize = juce::jmin(ChunkSize, numSamples);
+
+        const float* input = samples;
+        int count = chunkSize;
+
+        for (int s = 0; s < NumStages; ++s)
+        {
+            auto& stage = stages[s];
+
+            // stage s is fed by decimating the input of stage s - 1, the scratch buffers alternate
+            if (s > 0)
+            {
+                auto* output = chunks[(s - 1) % 2].data();
+                count = stage.decimator.process(input, count, output);
+                input = output;
+            }
+
+            stage.ringBuffer.write(input, count);
+            stage.samplesSinceLastFrame += count;
+        }
+
+        samples += chunkSize;
+        numSamples -= chunkSize;
+    }
+}
+
+bool MultiResolutionAnalyzer::produceFFTDataForRendering(float negativeInfinity)
+{
+    const auto stageSize = getStageFFTSize();
+    const auto hopSize = stageSize / 4;
+
+    bool anyFrame = false;
+
+    for (auto& stage : stages)
+    {
+        if (stage.samplesSinceLastFrame < hopSize)
+        {
+            continue;
+        }
+
+        stage.samplesSinceLastFrame = 0;
+
+        stage.ringBuffer.readWindowed(stageData.data(), windowTable.data(), stageSize);
+        forwardFFT.performFrequencyOnlyForwardTransform(stageData.data());
+
+        stitch(stage);
+        anyFrame = true;
+    }
+
+    if (!anyFrame)
+    {
+        return false;
+    }
+
+    const auto numBins = (int)fftData.size();
+    std::copy(stitchedMagnitudes.begin(), stitchedMagnitudes.end(), fftData.begin());
+
+    smoother.configure(requestedSmoothing.load(), numBins);
+    smoother.process(fftData.data(), numBins);
+
+    // every stage has the same FFT size, so they share one normalization
+    magnitudesToDecibels(fftData.data(), numBins, 2.f / (float)stageSize, negativeInfinity);
+
+    return true;
+}
+
+void MultiResolutionAnalyzer::stitch(const Stage& stage)
+{
+    const auto maxDecimation = 1 << (NumStages - 1);
+    const auto binRatio = float(stage.decimation) / float(maxDecimation);
+    const auto lastStageBin = getStageFFTSize() / 2;
+
+    for (int k = stage.firstBin; k < stage.endBin; ++k)
+    {
+        // the stitched bin k lies at this fractional bin of the stage's FFT
+        auto position = k * binRatio;
+        auto lower = juce::jmin((int)position, lastStageBin - 1);
+        auto fraction = position - (float)lower;
+
+        stitchedMagnitudes[k] = stageData[lower] + fraction * (stageData[lower + 1] - stageData[lower]);
+    }
+}
@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    MultiResolutionAnalyzer.h
+    Created: 19 Oct 2026 5:52:14pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "Utilities.h"
+#include "SpectrumKernels.h"
+#include "OctaveSmoother.h"
+#include "../DSP/AnalysisRingBuffer.h"
+#include "../DSP/HalfBandDecimator.h"
+
+//==============================================================================
+/**
+ spectrum analyzer with a finer resolution in the bass than in the treble.
+ a cascade of half-band decimators feeds one small FFT per stage: the top octaves
+ come from the full rate signal, each lower range from a signal decimated once more.
+ the stages are stitched into the bins of one large FFT, so the result can be used
+ exactly like the output of an FFTDataGenerator of getStitchedFFTSize().
+
+ a decimated stage only needs a new frame every 'decimation' hops, so with three
+ stages the cost is about 1.75 small FFTs per hop, for the bass resolution of an FFT
+ four times larger.
+*/
+struct MultiResolutionAnalyzer
+{
+    static constexpr int NumStages = 3;
+    static constexpr int StageFFTOrder = FFTOrder::order2048;
+
+    static constexpr int getStageFFTSize() { return 1 << StageFFTOrder; }
+    static constexpr int getStitchedFFTSize() { return getStageFFTSize() << (NumStages - 1); }
+
+    MultiResolutionAnalyzer();
+
+    /*
+     forgets all history, for instance after the analyzer was switched over to this mode.
+     */
+    void reset();
+
+    /*
+     appends full rate samples, decimating them into every stage.
+     */
+    void push(const float* samples, int numSamples);
+
+    /*
+     runs the FFT of every stage that received at least a hop of new samples since its
+     last frame, and restitches the output. returns false when no stage was due.
+     */
+    bool produceFFTDataForRendering(float negativeInfinity);
+
+    void setSmoothing(OctaveSmoothing newSmoothing) { requestedSmoothing.store(newSmoothing); }
+
+    /*
+     the dB values of the stitched spectrum, getStitchedFFTSize() / 2 bins.
+     */
+    const std::vector<float>& getFFTData() const { return fftData; }
+private:
+    struct Stage
+    {
+        HalfBandDecimator decimator;
+        AnalysisRingBuffer ringBuffer;
+        int samplesSinceLastFrame = 0;
+
+        // 1 << index: the decimation of this stage relative to the input
+        int decimation = 1;
+
+        // the stitched bins [firstBin, endBin) are read from this stage
+        int firstBin = 0;
+        int endBin = 0;
+    };
+
+    std::array<Stage, NumStages> stages;
+
+    juce::dsp::FFT forwardFFT{ StageFFTOrder };
+    std::vector<float> windowTable;
+    std::vector<float> stageData;
+
+    // decimation scratch, processed in chunks of this size
+    static constexpr int ChunkSize = 512;
+    std::array<std::vector<float>, 2> chunks;
+
+    std::vector<float> stitchedMagnitudes;
+    std::vector<float> fftData;
+
+    OctaveSmoother smoother;
+    std::atomic<OctaveSmoothing> requestedSmoothing{ OctaveSmoothing::noSmoothing };
+
+    void stitch(const Stage& stage);
+};
@@ -0,0 +1,79 @@
+/*
+  ==============================================================================
+
+    OctaveSmoother.cpp
+    Created: 19 Oct 2026 4:12:35pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "OctaveSmoother.h"
+
+//==============================================================================
+void OctaveSmoother::prepare(int maxNumBins)
+{
+    powerSums.resize(maxNumBins + 1, 0.0);
+
+    lowerEdges.resize(maxNumBins, 0);
+    upperEdges.resize(maxNumBins, 0);
+    reciprocalWidths.resize(maxNumBins, 0.f);
+
+    // the edges must be rebuilt for the new storage
+    configuredNumBins = 0;
+}
+
+void OctaveSmoother::configure(OctaveSmoothing newSmoothing, int numBins)
+{
+    numBins = juce::jmin(numBins, (int)lowerEdges.size());
+
+    if (newSmoothing == smoothing && numBins == configuredNumBins)
+    {
+        return;
+    }
+
+    smoothing = newSmoothing;
+    configuredNumBins = numBins;
+
+    if (!isActive())
+    {
+        return;
+    }
+
+    // a 1/N octave window spans half of 1/N octave on each side of the bin
+    const auto halfWidth = std::pow(2.0, 1.0 / (2.0 * (int)smoothing));
+
+    for (int k = 0; k < numBins; ++k)
+    {
+        auto lower = juce::jlimit(0, k, (int)std::floor(k / halfWidth));
+        auto upper = juce::jlimit(k + 1, numBins, (int)std::ceil(k * halfWidth) + 1);
+
+        lowerEdges[k] = lower;
+        upperEdges[k] = upper;
+        reciprocalWidths[k] = 1.f / float(upper - lower);
+    }
+}
+
+void OctaveSmoother::process(float* magnitudes, int numBins)
+{
+    if (!isActive())
+    {
+        return;
+    }
+
+    numBins = juce::jmin(numBins, configuredNumBins);
+
+    // summed in double: the windows at the top of the spectrum subtract
+    // two large sums to get a small one
+    powerSums[0] = 0.0;
+    for (int k = 0; k < numBins; ++k)
+    {
+        powerSums[k + 1] = powerSums[k] + double(magnitudes[k]) * magnitudes[k];
+    }
+
+    for (int k = 0; k < numBins; ++k)
+    {
+        auto power = float(powerSums[upperEdges[k]] - powerSums[lowerEdges[k]]);
+        magnitudes[k] = std::sqrt(juce::jmax(0.f, power * reciprocalWidths[k]));
+    }
+}
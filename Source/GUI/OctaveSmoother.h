@@ -0,0 +1,49 @@
+/*
+  ==============================================================================
+
+    OctaveSmoother.h
+    Created: 19 Oct 2026 4:12:35pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "Utilities.h"
+
+//==============================================================================
+/**
+ fractional-octave smoothing of an FFT magnitude spectrum.
+ every bin becomes the RMS of the bins within its window, read from prefix sums
+ of the power spectrum, so a frame costs O(numBins) whatever the window width.
+*/
+struct OctaveSmoother
+{
+    /*
+     sizes everything for spectra of up to 'maxNumBins' bins.
+     */
+    void prepare(int maxNumBins);
+
+    /*
+     rebuilds the window edges, only when the smoothing or the number of bins changed.
+     the edges are relative to the bin index, so they do not depend on the sample rate.
+     */
+    void configure(OctaveSmoothing newSmoothing, int numBins);
+
+    bool isActive() const { return smoothing != OctaveSmoothing::noSmoothing; }
+
+    /*
+     smooths 'magnitudes' in place, with the configuration of the last configure() call.
+     */
+    void process(float* magnitudes, int numBins);
+private:
+    OctaveSmoothing smoothing{ OctaveSmoothing::noSmoothing };
+    int configuredNumBins = 0;
+
+    std::vector<double> powerSums;
+
+    // window of bin k: [lowerEdges[k], upperEdges[k]), averaged with reciprocalWidths[k]
+    std::vector<int> lowerEdges, upperEdges;
+    std::vector<float> reciprocalWidths;
+};
@@ -10,49 +10,126 @@
 
 #include "PathProducer.h"
 
-void PathProducer::process(juce::Rectangle<float> fftBounds, double sampleRate)
+bool PathProducer::process(juce::Rectangle<float> fftBounds, double sampleRate)
 {
-    juce::AudioBuffer<float> tempIncomingBuffer;
+    auto previousFFTSize = leftChannelFFTDataGenerator.getFFTSize();
+    if (leftChannelFFTDataGenerator.applyPendingOrder())
+    {
+        // keep the same overlap at the new resolution
+        setHopSize(hopSize * leftChannelFFTDataGenerator.getFFTSize() / previousFFTSize);
+
+        // the bins no longer line up with the averaged history
+        if (!multiResolutionActive)
+        {
+            averager.reset(negativeInfinity);
+        }
+    }
 
+    if (multiResolutionEnabled != multiResolutionActive)
+    {
+        multiResolutionActive = multiResolutionEnabled;
+
+        // the decimated stages only get fed while active, so they restart from silence
+        multiResolutionAnalyzer.reset();
+        averager.reset(negativeInfinity);
+        samplesSinceLastFrame = 0;
+    }
+
+    // drain everything the audio thread queued, the ring only keeps the newest samples anyway
     while (leftChannelFifo->genNumCompleteBuffersAvailable() > 0)
     {
-        if (leftChannelFifo->getAudioBuffer(tempIncomingBuffer))
+        if (leftChannelFifo->getAudioBuffer(incomingBuffer))
         {
-            auto size = tempIncomingBuffer.getNumSamples();
-            
-            jassert(size <= monoBuffer.getNumSamples());
-            size = juce::jmin(size, monoBuffer.getNumSamples());
-            
-            auto writePointer = monoBuffer.getWritePointer(0, 0);
-            auto readPointer = monoBuffer.getReadPointer(0, size);
-
-            std::copy(readPointer,
-                      readPointer + monoBuffer.getNumSamples() - size,
-                      writePointer);
-
-            juce::FloatVectorOperations::copy(monoBuffer.getWritePointer(0, monoBuffer.getNumSamples() - size),
-                tempIncomingBuffer.getReadPointer(0, 0),
-                size
-            );
-
-            leftChannelFFTDataGenerator.produceFFTDataForRendering(monoBuffer, negativeInfinity);
+            const auto* samples = incomingBuffer.getReadPointer(0, 0);
+            const auto numSamples = incomingBuffer.getNumSamples();
+
+            // the ring stays current either way, so switching back has a full window at once
+            ringBuffer.write(samples, numSamples);
+
+            if (multiResolutionActive)
+            {
+                multiResolutionAnalyzer.push(samples, numSamples);
+            }
+
+            samplesSinceLastFrame += numSamples;
         }
     }
 
-    auto fftSize = leftChannelFFTDataGenerator.getFFTSize();
+    if (sampleRate <= 0.0)
+    {
+        samplesSinceLastFrame = 0;
+        return false;
+    }
+
+    const std::vector<float>* frame = nullptr;
+    int fftSize = 0;
+
+    if (!produceFrame(frame, fftSize))
+    {
+        return false;
+    }
+
+    const auto frameInterval = float(samplesSinceLastFrame / sampleRate);
+    samplesSinceLastFrame = 0;
+
     const auto binWidth = sampleRate / (double)fftSize;
 
-    while (leftChannelFFTDataGenerator.getNumAvailableFFTDataBlocks() > 0)
+    averager.process(frame->data(), fftSize / 2, frameInterval);
+
+    // both are always generated, so no path is left behind with a stale frame
+    auto changed = pathProducer.generatePath(averager.getAverage(), fftBounds, fftSize, binWidth, negativeInfinity);
+    changed |= peakPathProducer.generatePath(averager.getPeak(), fftBounds, fftSize, binWidth, negativeInfinity);
+
+    // the paths aren't shown under the waterfall, only a new column needs a repaint there
+    const auto columnPushed = waterfallEnabled && waterfall.pushFrame(*frame, fftSize, binWidth, negativeInfinity);
+
+    if (bandOverlayEnabled)
+    {
+        // only recomputed when a crossover, the FFT order or the sample rate moved
+        crossoverResponse.update(lowMidFrequency, midHighFrequency, fftSize, sampleRate);
+
+        const auto& average = averager.getAverage();
+        const auto numBins = fftSize / 2;
+
+        for (int band = 0; band < CrossoverResponse::NumBands; ++band)
+        {
+            const auto& response = crossoverResponse.getResponse(static_cast<CrossoverResponse::Band>(band));
+
+            juce::FloatVectorOperations::add(bandData.data(), average.data(), response.data(), numBins);
+            juce::FloatVectorOperations::max(bandData.data(), bandData.data(), negativeInfinity, numBins);
+
+            changed |= bandPathProducers[band].generatePath(bandData, fftBounds, fftSize, binWidth, negativeInfinity);
+        }
+    }
+
+    return waterfallEnabled ? columnPushed : changed;
+}
+
+bool PathProducer::produceFrame(const std::vector<float>*& frame, int& fftSize)
+{
+    if (multiResolutionActive)
     {
-        std::vector<float> fftData;
-        if (leftChannelFFTDataGenerator.getFFTData(fftData));
+        // each stage keeps its own hop, at its own rate
+        if (!multiResolutionAnalyzer.produceFFTDataForRendering(negativeInfinity))
         {
-            pathProducer.generatePath(fftData, fftBounds, fftSize, binWidth, negativeInfinity);
+            return false;
         }
+
+        frame = &multiResolutionAnalyzer.getFFTData();
+        fftSize = MultiResolutionAnalyzer::getStitchedFFTSize();
+        return true;
     }
 
-    while (pathProducer.getNumPathsAvailable() > 0)
+    if (samplesSinceLastFrame < hopSize)
     {
-        pathProducer.getPath(leftChannelFFTPath);
+        return false;
     }
-}
\ No newline at end of file
+
+    // one FFT on the newest window, however many hops went by since the last one.
+    // after a stall this costs a single frame instead of replaying the backlog.
+    leftChannelFFTDataGenerator.produceFFTDataForRendering(ringBuffer, negativeInfinity);
+
+    frame = &leftChannelFFTDataGenerator.getFFTData();
+    fftSize = leftChannelFFTDataGenerator.getFFTSize();
+    return true;
+}
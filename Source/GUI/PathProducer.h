@@ -11,8 +11,13 @@
 #pragma once
 #include <JuceHeader.h>
 #include "../DSP/SingleChannelSampleFifo.h"
+#include "../DSP/AnalysisRingBuffer.h"
 #include "AnalyzerPathGenerator.h"
 #include "FFTDataGenerator.h"
+#include "MultiResolutionAnalyzer.h"
+#include "SpectrumAverager.h"
+#include "CrossoverResponse.h"
+#include "Waterfall.h"
 #include "Utilities.h"
 #include "../PluginProcessor.h"
 
@@ -22,22 +27,134 @@ struct PathProducer
         leftChannelFifo(&scsf)
     {
         leftChannelFFTDataGenerator.changeOrder(FFTOrder::order2048);
-        monoBuffer.setSize(1, leftChannelFFTDataGenerator.getFFTSize());
+        ringBuffer.prepare(leftChannelFFTDataGenerator.getMaxFFTSize());
+        setHopSize(leftChannelFFTDataGenerator.getFFTSize() / 4);
+
+        static_assert(MultiResolutionAnalyzer::getStitchedFFTSize() <= FFTDataGenerator<std::vector<float>>::getMaxFFTSize(),
+                      "the multi-resolution spectrum must fit the storage sized for the largest FFT");
+
+        averager.prepare(leftChannelFFTDataGenerator.getMaxFFTSize() / 2);
+        averager.reset(negativeInfinity);
+
+        crossoverResponse.prepare(leftChannelFFTDataGenerator.getMaxFFTSize() / 2);
+        bandData.resize(leftChannelFFTDataGenerator.getMaxFFTSize() / 2, 0);
+    }
+    /*
+     returns true when one of the paths visibly changed and the analyzer needs a repaint,
+     or with the waterfall enabled, when a column was written to it.
+     */
+    bool process(juce::Rectangle<float> fftBounds, double sampleRate);
+
+    /*
+     the latest paths, for the paint call. each call hands over the newest
+     generated path if there is one, otherwise the previous one is returned.
+     */
+    const juce::Path& getPath()
+    {
+        pathProducer.pullLatestPath();
+        return pathProducer.getPath();
+    }
+
+    const juce::Path& getPeakPath()
+    {
+        peakPathProducer.pullLatestPath();
+        return peakPathProducer.getPath();
+    }
+
+    const juce::Path& getBandPath(CrossoverResponse::Band band)
+    {
+        bandPathProducers[band].pullLatestPath();
+        return bandPathProducers[band].getPath();
+    }
+
+    /*
+     when enabled, each frame also produces one path per band: the averaged spectrum
+     shaped by the crossover's magnitude responses.
+     */
+    void setBandOverlayEnabled(bool enabled) { bandOverlayEnabled = enabled; }
+    void setCrossoverFrequencies(float lowMid, float midHigh)
+    {
+        lowMidFrequency = lowMid;
+        midHighFrequency = midHigh;
+    }
+
+    /*
+     when enabled, every frame is also written to the waterfall, unaveraged,
+     so level movements such as compressor pumping stay visible.
+     */
+    void setWaterfallEnabled(bool enabled) { waterfallEnabled = enabled; }
+    void prepareWaterfall(int historyLength, int height) { waterfall.prepare(historyLength, height); }
+    const Waterfall& getWaterfall() const { return waterfall; }
+
+    void setAveragingTime(float seconds) { averager.setAveragingTime(seconds); }
+    void setPeakHold(float holdSeconds, float fallDecibelsPerSecond)
+    {
+        averager.setPeakHoldTime(holdSeconds);
+        averager.setPeakFallRate(fallDecibelsPerSecond);
     }
-    void process(juce::Rectangle<float> fftBounds, double sampleRate);
-    juce::Path getPath() { return leftChannelFFTPath; };
 
     void updateNegativeInfinity(float nf) { negativeInfinity = nf; }
+
+    /*
+     minimum number of new samples before the next FFT frame is computed,
+     i.e. at least fftSize / hopSize consecutive frames overlap.
+     */
+    void setHopSize(int newHopSize)
+    {
+        hopSize = juce::jlimit(1, leftChannelFFTDataGenerator.getFFTSize(), newHopSize);
+    }
+    int getHopSize() const { return hopSize; }
+
+    /*
+     the new resolution is picked up at the start of the next process() call.
+     */
+    void changeOrder(FFTOrder newOrder) { leftChannelFFTDataGenerator.changeOrder(newOrder); }
+
+    void setSmoothing(OctaveSmoothing smoothing)
+    {
+        leftChannelFFTDataGenerator.setSmoothing(smoothing);
+        multiResolutionAnalyzer.setSmoothing(smoothing);
+    }
+
+    /*
+     when enabled, frames come from the MultiResolutionAnalyzer instead of the single FFT,
+     and the FFT order is ignored. picked up at the start of the next process() call.
+     */
+    void setMultiResolutionEnabled(bool enabled) { multiResolutionEnabled = enabled; }
 private:
     SingleChannelSampleFifo<SimpleMBCompAudioProcessor::BlockType>* leftChannelFifo;
 
-    juce::AudioBuffer<float> monoBuffer;
+    juce::AudioBuffer<float> incomingBuffer;
+
+    AnalysisRingBuffer ringBuffer;
+    int hopSize = 1;
+    int samplesSinceLastFrame = 0;
 
     FFTDataGenerator<std::vector<float>> leftChannelFFTDataGenerator;
 
-    AnalyzerPathGenerator<juce::Path> pathProducer;
+    bool multiResolutionEnabled = false;
+    bool multiResolutionActive = false;
+    MultiResolutionAnalyzer multiResolutionAnalyzer;
+
+    /*
+     computes the next frame, from whichever analyzer is active.
+     returns false when none is due yet.
+     */
+    bool produceFrame(const std::vector<float>*& frame, int& fftSize);
+
+    SpectrumAverager averager;
+
+    AnalyzerPathGenerator<juce::Path> pathProducer, peakPathProducer;
+
+    bool bandOverlayEnabled = false;
+    float lowMidFrequency = 0.f;
+    float midHighFrequency = 0.f;
+    CrossoverResponse crossoverResponse;
+    std::vector<float> bandData;
+    std::array<AnalyzerPathGenerator<juce::Path>, CrossoverResponse::NumBands> bandPathProducers;
 
-    juce::Path leftChannelFFTPath;
+    bool waterfallEnabled = false;
+    Waterfall waterfall;
 
     float negativeInfinity{ -48.f };
 };
\ No newline at end of file
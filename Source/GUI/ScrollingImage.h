@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+
+    ScrollingImage.h
+    Created: 19 Oct 2026 2:41:26pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ an image used as a ring of pixel columns, for views that scroll with time.
+ each update overwrites the oldest column in place and draw() unwraps the ring
+ with two blits, so nothing is ever shifted, whatever the history length.
+*/
+struct ScrollingImage
+{
+    /*
+     'width' columns of history, 'height' pixels each. clears the history.
+     */
+    void prepare(int width, int height, juce::Colour background)
+    {
+        image = juce::Image(juce::Image::ARGB, juce::jmax(1, width), juce::jmax(1, height), false);
+        image.clear(image.getBounds(), background);
+        nextColumn = 0;
+    }
+
+    bool isEmpty() const { return image.isNull(); }
+
+    int getWidth() const { return image.getWidth(); }
+    int getHeight() const { return image.getHeight(); }
+
+    /*
+     overwrites the oldest column, which then becomes the newest.
+     'fill' is called as fill(juce::Image::BitmapData& column), with a 1 pixel wide
+     bitmap of the column to write.
+     */
+    template<typename FillFunction>
+    void pushColumn(FillFunction&& fill)
+    {
+        if (image.isNull())
+        {
+            return;
+        }
+
+        {
+            juce::Image::BitmapData column(image, nextColumn, 0, 1, image.getHeight(),
+                                           juce::Image::BitmapData::writeOnly);
+            fill(column);
+        }
+
+        nextColumn = (nextColumn + 1) % image.getWidth();
+    }
+
+    /*
+     draws the history into 'area', oldest column on the left and newest on the right.
+     */
+    void draw(juce::Graphics& g, juce::Rectangle<int> area) const
+    {
+        if (image.isNull() || area.isEmpty())
+        {
+            return;
+        }
+
+        const auto width = image.getWidth();
+        const auto height = image.getHeight();
+
+        // columns [nextColumn, width) are the oldest, [0, nextColumn) the newest
+        const auto olderColumns = width - nextColumn;
+        const auto split = area.getX() + area.getWidth() * olderColumns / width;
+
+        g.drawImage(image,
+                    area.getX(), area.getY(), split - area.getX(), area.getHeight(),
+                    nextColumn, 0, olderColumns, height);
+
+        if (nextColumn > 0)
+        {
+            g.drawImage(image,
+                        split, area.getY(), area.getRight() - split, area.getHeight(),
+                        0, 0, nextColumn, height);
+        }
+    }
+private:
+    juce::Image image;
+    int nextColumn = 0;
+};
@@ -21,26 +21,24 @@ rightPathProducer(audioProcessor.rightChannelFifo)
         param->addListener(this);
     }
 
-    const auto& paramNames = Params::GetParams();
+    using namespace Params;
+    const auto& parameters = audioProcessor.parameters;
 
-    auto floatHelper = [&apvts = audioProcessor.apvts, &paramNames](auto& param, const auto& paramName)
-    {
-        param = dynamic_cast<juce::AudioParameterFloat*>(apvts.getParameter(paramNames.at(paramName)));
-        jassert(param != nullptr);
-    };
-
-    floatHelper(lowMidXoverParam, Params::Names::Low_Mid_Crossover_Freq);
-    floatHelper(midHighXoverParam, Params::Names::Mid_High_Crossover_Freq);
+    lowMidXoverParam = &parameters.getFloat(Names::Low_Mid_Crossover_Freq);
+    midHighXoverParam = &parameters.getFloat(Names::Mid_High_Crossover_Freq);
 
-    floatHelper(lowThresholdParam, Params::Names::Threshold_Low_Band);
-    floatHelper(midThresholdParam, Params::Names::Threshold_Mid_Band);
-    floatHelper(highThresholdParam, Params::Names::Threshold_High_Band);
+    lowThresholdParam = &parameters.getFloat(Names::Threshold_Low_Band);
+    midThresholdParam = &parameters.getFloat(Names::Threshold_Mid_Band);
+    highThresholdParam = &parameters.getFloat(Names::Threshold_High_Band);
 
-    startTimerHz(60);
+    updateAnalyzerConsumption();
 }
 
 SpectrumAnalyzer::~SpectrumAnalyzer()
 {
+    shouldShowFFTAnalysis = false;
+    updateAnalyzerConsumption();
+
     const auto& params = audioProcessor.getParameters();
     for (auto param : params)
     {
@@ -217,17 +215,44 @@ void SpectrumAnalyzer::drawFFTAnalysis(juce::Graphics& g, juce::Rectangle<int> b
     Graphics::ScopedSaveState sss(g);
     g.reduceClipRegion(responseArea);
 
-    auto leftChannelFFTPath = leftPathProducer.getPath();
-    leftChannelFFTPath.applyTransform(AffineTransform().translation(responseArea.getX(), 0));
+    // the paths are stroked in place with an offset, never copied
+    const auto toAnalysisArea = AffineTransform::translation((float)responseArea.getX(), 0.f);
+    const PathStrokeType stroke(1.f);
 
-    g.setColour(Colours::lightblue);
-    g.strokePath(leftChannelFFTPath, PathStrokeType(1.f));
+    g.setColour(Colours::lightblue.withAlpha(0.4f));
+    g.strokePath(leftPathProducer.getPeakPath(), stroke, toAnalysisArea);
 
-    auto rightChannelFFTPath = rightPathProducer.getPath();
-    rightChannelFFTPath.applyTransform(AffineTransform().translation(responseArea.getX(), 0));
+    g.setColour(Colours::yellow.withAlpha(0.4f));
+    g.strokePath(rightPathProducer.getPeakPath(), stroke, toAnalysisArea);
+
+    g.setColour(Colours::lightblue);
+    g.strokePath(leftPathProducer.getPath(), stroke, toAnalysisArea);
 
     g.setColour(Colours::yellow);
-    g.strokePath(rightChannelFFTPath, PathStrokeType(1.f));
+    g.strokePath(rightPathProducer.getPath(), stroke, toAnalysisArea);
+
+    if (shouldShowBandOverlay)
+    {
+        const std::array<Colour, CrossoverResponse::NumBands> bandColours
+        {
+            Colours::cyan,
+            Colours::limegreen,
+            Colours::hotpink
+        };
+
+        for (int band = 0; band < CrossoverResponse::NumBands; ++band)
+        {
+            g.setColour(bandColours[band].withAlpha(0.7f));
+            g.strokePath(leftPathProducer.getBandPath(static_cast<CrossoverResponse::Band>(band)),
+                         stroke,
+                         toAnalysisArea);
+        }
+    }
+}
+
+void SpectrumAnalyzer::drawWaterfall(juce::Graphics& g, juce::Rectangle<int> bounds)
+{
+    leftPathProducer.getWaterfall().draw(g, getAnalysisArea(bounds));
 }
 
 void SpectrumAnalyzer::drawCrossovers(juce::Graphics& g, juce::Rectangle<int> bounds)
@@ -240,58 +265,226 @@ void SpectrumAnalyzer::drawCrossovers(juce::Graphics& g, juce::Rectangle<int> bo
     const auto bottom = bounds.getBottom();
     const auto left = bounds.getX();
     const auto right = bounds.getRight();
-    const auto width = bounds.getWidth();
 
-    auto mapX = [left, width](float frequency)
+    auto geometry = computeOverlayGeometry(bounds);
+
+    g.setColour(Colours::orange);
+    g.drawVerticalLine(geometry.lowMidX, top, bottom);
+    g.drawVerticalLine(geometry.midHighX, top, bottom);
+
+    g.setColour(Colours::yellow);
+    g.drawHorizontalLine(geometry.lowThresholdY,
+                         left,
+                         geometry.lowMidX);
+
+    g.drawHorizontalLine(geometry.midThresholdY,
+                         geometry.lowMidX,
+                         geometry.midHighX);
+
+    g.drawHorizontalLine(geometry.highThresholdY,
+                         geometry.midHighX,
+                         right);
+
+    paintedOverlay = geometry;
+}
+
+void SpectrumAnalyzer::drawGainReduction(juce::Graphics& g, juce::Rectangle<int> bounds)
+{
+    using namespace juce;
+
+    bounds = getAnalysisArea(bounds);
+
+    auto geometry = computeOverlayGeometry(bounds);
+
+    const std::array<float, SimpleMBCompAudioProcessor::NumBands + 1> edges
     {
-        return getXMapping(frequency, left, width);
+        float(bounds.getX()),
+        geometry.lowMidX,
+        geometry.midHighX,
+        float(bounds.getRight())
     };
 
-    auto lowMidX = mapX(lowMidXoverParam->get());
-    g.setColour(Colours::orange);
-    g.drawVerticalLine(lowMidX, top, bottom);
+    g.setColour(Colour(255u, 154u, 1u).withAlpha(0.5f));
+
+    for (size_t band = 0; band < gainReductions.size(); ++band)
+    {
+        auto height = getGainReductionHeight(gainReductions[band], bounds);
+
+        g.fillRect(Rectangle<float>(edges[band], float(bounds.getY()),
+                                    edges[band + 1] - edges[band], height));
+    }
+}
 
-    auto midHighX = mapX(midHighXoverParam->get());
-    g.drawVerticalLine(midHighX, top, bottom);
+float SpectrumAnalyzer::getGainReductionHeight(float gainReduction, juce::Rectangle<int> analysisArea) const
+{
+    auto pixelsPerDecibel = analysisArea.getHeight() / (MAX_DECIBELS - NEGATIVE_INFINITY);
+    return juce::jmin(float(analysisArea.getHeight()), -gainReduction * pixelsPerDecibel);
+}
+
+bool SpectrumAnalyzer::updateGainReduction(juce::Rectangle<int> analysisArea)
+{
+    float repaintHeight = 0.f;
+
+    for (size_t band = 0; band < gainReductions.size(); ++band)
+    {
+        auto gainReduction = audioProcessor.getBandTelemetry((int)band).read().gainReduction;
+
+        if (std::abs(gainReduction - gainReductions[band]) < 0.1f)
+        {
+            continue;
+        }
+
+        // the strip has to cover both the bar as painted and the bar to come
+        repaintHeight = juce::jmax(repaintHeight,
+                                   getGainReductionHeight(gainReductions[band], analysisArea),
+                                   getGainReductionHeight(gainReduction, analysisArea));
+
+        gainReductions[band] = gainReduction;
+    }
+
+    if (repaintHeight <= 0.f)
+    {
+        return false;
+    }
+
+    repaint(analysisArea.withHeight(juce::roundToInt(std::ceil(repaintHeight)) + 1));
+    return true;
+}
+
+SpectrumAnalyzer::OverlayGeometry SpectrumAnalyzer::computeOverlayGeometry(juce::Rectangle<int> analysisArea) const
+{
+    const auto top = float(analysisArea.getY());
+    const auto bottom = float(analysisArea.getBottom());
+    const auto left = float(analysisArea.getX());
+    const auto width = float(analysisArea.getWidth());
+
+    OverlayGeometry geometry;
 
-    auto mapY = [bottom, top](float gain)
+    geometry.lowMidX = getXMapping(lowMidXoverParam->get(), left, width);
+    geometry.midHighX = getXMapping(midHighXoverParam->get(), left, width);
+
+    geometry.lowThresholdY = getYMapping(lowThresholdParam->get(), bottom, top);
+    geometry.midThresholdY = getYMapping(midThresholdParam->get(), bottom, top);
+    geometry.highThresholdY = getYMapping(highThresholdParam->get(), bottom, top);
+
+    return geometry;
+}
+
+bool SpectrumAnalyzer::repaintOverlayChanges(juce::Rectangle<int> analysisArea)
+{
+    auto next = computeOverlayGeometry(analysisArea);
+    const auto& painted = paintedOverlay;
+
+    // a few pixels either side of a line cover its anti-aliasing
+    constexpr int margin = 2;
+
+    auto repaintColumn = [this, analysisArea](float x)
     {
-        return getYMapping(gain, bottom, top);
+        repaint(juce::Rectangle<int>(int(x) - margin, analysisArea.getY(),
+                                     2 * margin + 1, analysisArea.getHeight()));
     };
 
-    g.setColour(Colours::yellow);
-    g.drawHorizontalLine(mapY(lowThresholdParam->get()),
-                         left,
-                         lowMidX);
+    auto repaintRow = [this, analysisArea](float y)
+    {
+        repaint(juce::Rectangle<int>(analysisArea.getX(), int(y) - margin,
+                                     analysisArea.getWidth(), 2 * margin + 1));
+    };
 
-    g.drawHorizontalLine(mapY(midThresholdParam->get()),
-                         lowMidX,
-                         midHighX);
+    if (next.lowMidX != painted.lowMidX || next.midHighX != painted.midHighX)
+    {
+        // the threshold lines span between the crossovers, so they move with them
+        for (auto x : { painted.lowMidX, painted.midHighX, next.lowMidX, next.midHighX })
+        {
+            repaintColumn(x);
+        }
 
-    g.drawHorizontalLine(mapY(highThresholdParam->get()),
-                         midHighX,
-                         right);
+        for (auto y : { painted.lowThresholdY, painted.midThresholdY, painted.highThresholdY,
+                        next.lowThresholdY, next.midThresholdY, next.highThresholdY })
+        {
+            repaintRow(y);
+        }
+
+        return true;
+    }
+
+    auto repaintRowIfMoved = [&repaintRow](float paintedY, float nextY)
+    {
+        if (paintedY == nextY)
+        {
+            return false;
+        }
+
+        repaintRow(paintedY);
+        repaintRow(nextY);
+        return true;
+    };
+
+    auto moved = repaintRowIfMoved(painted.lowThresholdY, next.lowThresholdY);
+    moved |= repaintRowIfMoved(painted.midThresholdY, next.midThresholdY);
+    moved |= repaintRowIfMoved(painted.highThresholdY, next.highThresholdY);
+
+    return moved;
 }
 
 void SpectrumAnalyzer::paint(juce::Graphics& g)
 {
     using namespace juce;
 
-    g.fillAll(Colours::black);
-
-    auto bounds = drawModuleBackground(g, getLocalBounds());
+    // the module background, grid and labels only change on resize or scale change
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (background.isNull() || scale != backgroundScale)
+    {
+        renderBackground(scale);
+    }
 
-    drawBackGroundGrid(g, bounds);
+    g.drawImage(background, getLocalBounds().toFloat());
 
     if (shouldShowFFTAnalysis)
     {   
-        drawFFTAnalysis(g, bounds);
+        if (shouldShowWaterfall)
+        {
+            drawWaterfall(g, moduleBounds);
+        }
+        else
+        {
+            drawFFTAnalysis(g, moduleBounds);
+        }
+    }
+
+    if (!isShowingWaterfall())
+    {
+        if (shouldShowGainReductionHistory)
+        {
+            gainReductionGraph.draw(g, getAnalysisArea(moduleBounds));
+        }
+
+        drawGainReduction(g, moduleBounds);
+
+        drawCrossovers(g, moduleBounds);
     }
+}
+
+void SpectrumAnalyzer::renderBackground(float scale)
+{
+    using namespace juce;
+
+    backgroundScale = scale;
+
+    background = Image(Image::RGB,
+                       jmax(1, roundToInt(getWidth() * scale)),
+                       jmax(1, roundToInt(getHeight() * scale)),
+                       true);
+
+    Graphics g(background);
+    g.addTransform(AffineTransform::scale(scale));
+
+    g.fillAll(Colours::black);
 
-    drawCrossovers(g, bounds);
+    moduleBounds = drawModuleBackground(g, getLocalBounds());
 
-    drawTextLabels(g, bounds);
+    drawBackGroundGrid(g, moduleBounds);
 
+    drawTextLabels(g, moduleBounds);
 }
 
 void SpectrumAnalyzer::resized()
@@ -305,6 +498,14 @@ void SpectrumAnalyzer::resized()
                        NEGATIVE_INFINITY, MAX_DECIBELS);
     leftPathProducer.updateNegativeInfinity(negInf);
     rightPathProducer.updateNegativeInfinity(negInf);
+
+    // one frame per pixel column of history
+    auto waterfallArea = getAnalysisArea(bounds);
+    leftPathProducer.prepareWaterfall(waterfallArea.getWidth(), waterfallArea.getHeight());
+    gainReductionGraph.prepare(waterfallArea.getWidth(), waterfallArea.getHeight(), audioProcessor);
+
+    // rebuilt at the next paint, with the new size
+    background = Image();
 }
 
 void SpectrumAnalyzer::parameterValueChanged(int parameterIndex, float newValue)
@@ -315,10 +516,92 @@ void SpectrumAnalyzer::parameterValueChanged(int parameterIndex, float newValue)
 void SpectrumAnalyzer::toggleAnalysisEnablement(bool enabled)
 {
     shouldShowFFTAnalysis = enabled;
+    updateAnalyzerConsumption();
+
+    repaint(getAnalysisArea(moduleBounds));
+}
+
+void SpectrumAnalyzer::updateAnalyzerConsumption()
+{
+    if (shouldShowFFTAnalysis == isConsumingAnalyzerData)
+    {
+        return;
+    }
+
+    isConsumingAnalyzerData = shouldShowFFTAnalysis;
+
+    if (isConsumingAnalyzerData)
+    {
+        audioProcessor.addAnalyzerConsumer();
+    }
+    else
+    {
+        audioProcessor.removeAnalyzerConsumer();
+    }
+}
+
+void SpectrumAnalyzer::setFFTOrder(FFTOrder newOrder)
+{
+    leftPathProducer.changeOrder(newOrder);
+    rightPathProducer.changeOrder(newOrder);
+}
+
+void SpectrumAnalyzer::setMultiResolution(bool enabled)
+{
+    leftPathProducer.setMultiResolutionEnabled(enabled);
+    rightPathProducer.setMultiResolutionEnabled(enabled);
+}
+
+void SpectrumAnalyzer::setSmoothing(OctaveSmoothing smoothing)
+{
+    leftPathProducer.setSmoothing(smoothing);
+    rightPathProducer.setSmoothing(smoothing);
+}
+
+void SpectrumAnalyzer::toggleBandOverlay(bool enabled)
+{
+    shouldShowBandOverlay = enabled;
+    leftPathProducer.setBandOverlayEnabled(enabled);
+
+    repaint(getAnalysisArea(moduleBounds));
+}
+
+void SpectrumAnalyzer::toggleWaterfall(bool enabled)
+{
+    shouldShowWaterfall = enabled;
+    leftPathProducer.setWaterfallEnabled(enabled);
+
+    repaint(getAnalysisArea(moduleBounds));
+}
+
+void SpectrumAnalyzer::toggleGainReductionHistory(bool enabled)
+{
+    shouldShowGainReductionHistory = enabled;
+
+    // starts from now rather than from whatever was recorded while hidden
+    auto area = getAnalysisArea(getLocalBounds());
+    gainReductionGraph.prepare(area.getWidth(), area.getHeight(), audioProcessor);
+
+    repaint(getAnalysisArea(moduleBounds));
 }
 
-void SpectrumAnalyzer::timerCallback()
+void SpectrumAnalyzer::onVBlank()
 {
+    // minimised, covered by another tab or not yet on screen: nothing to refresh
+    if (!isShowing() || moduleBounds.isEmpty())
+    {
+        return;
+    }
+
+    ++vBlankCounter;
+    if (idleFrames >= IdleFramesBeforeBackOff && vBlankCounter % IdleFrameDivider != 0)
+    {
+        return;
+    }
+
+    const auto analysisArea = getAnalysisArea(moduleBounds);
+    bool analysisChanged = false;
+    bool overlayChanged = false;
 
     if (shouldShowFFTAnalysis)
     {
@@ -327,15 +610,38 @@ void SpectrumAnalyzer::timerCallback()
         fftBounds.setBottom(bounds.getBottom());
         auto sampleRate = audioProcessor.getSampleRate();
 
-        leftPathProducer.process(fftBounds, sampleRate);
-        rightPathProducer.process(fftBounds, sampleRate);
+        leftPathProducer.setCrossoverFrequencies(lowMidXoverParam->get(), midHighXoverParam->get());
+        analysisChanged = leftPathProducer.process(fftBounds, sampleRate);
+        analysisChanged |= rightPathProducer.process(fftBounds, sampleRate);
+    }
+
+    const auto showOverlays = !isShowingWaterfall();
+
+    if (analysisChanged)
+    {
+        // the crossover lines lie inside the analysis area, they get redrawn with it
+        parametersChanged.set(false);
+        repaint(analysisArea);
+    }
+    else if (showOverlays && parametersChanged.compareAndSetBool(false, true))
+    {
+        overlayChanged = repaintOverlayChanges(analysisArea);
     }
 
-    if (parametersChanged.compareAndSetBool(false, true))
+    // like the other overlays, hidden behind the waterfall. it catches up when shown again,
+    // with the columns the history still holds
+    if (showOverlays && shouldShowGainReductionHistory && gainReductionGraph.update(audioProcessor))
     {
+        // the whole graph scrolls, but only the new columns were rendered
+        analysisChanged = true;
+        repaint(analysisArea);
     }
 
-    repaint();
+    // the bars are cheap to check, and they must keep up even when the spectrum is static
+    auto gainReductionChanged = showOverlays && updateGainReduction(analysisArea);
+
+    auto anythingChanged = analysisChanged || overlayChanged || gainReductionChanged;
+    idleFrames = anythingChanged ? 0 : juce::jmin(idleFrames + 1, IdleFramesBeforeBackOff);
 }
 
 juce::Rectangle<int> SpectrumAnalyzer::getRenderArea(juce::Rectangle<int> bounds)
@@ -11,17 +11,16 @@
 #pragma once
 #include <JuceHeader.h>
 #include "PathProducer.h"
+#include "GainReductionGraph.h"
 
 struct SpectrumAnalyzer : juce::Component,
-    juce::AudioProcessorParameter::Listener,
-    juce::Timer
+    juce::AudioProcessorParameter::Listener
 {
     SpectrumAnalyzer(SimpleMBCompAudioProcessor&);
     ~SpectrumAnalyzer();
 
     void parameterValueChanged(int parameterIndex, float NewValue) override;
     void parameterGestureChanged(int parameterindex, bool gestureIsStarting) override {};
-    void timerCallback() override;
 
     void paint(juce::Graphics& g) override;
 
@@ -29,6 +28,18 @@ struct SpectrumAnalyzer : juce::Component,
 
     void toggleAnalysisEnablement(bool enabled);
 
+    void setFFTOrder(FFTOrder newOrder);
+
+    void setMultiResolution(bool enabled);
+
+    void setSmoothing(OctaveSmoothing smoothing);
+
+    void toggleBandOverlay(bool enabled);
+
+    void toggleWaterfall(bool enabled);
+
+    void toggleGainReductionHistory(bool enabled);
+
     std::vector<float> getGains();
     std::vector<float> getFrequencies();
     std::vector<float> getXs(const std::vector<float>& freqs, float left, float width);
@@ -46,6 +57,10 @@ private:
     //void updateChain();
 
     juce::Image background;
+    float backgroundScale = 1.f;
+    juce::Rectangle<int> moduleBounds;
+
+    void renderBackground(float scale);
 
     juce::Rectangle<int> getRenderArea(juce::Rectangle<int> bounds);
 
@@ -54,15 +69,77 @@ private:
     PathProducer leftPathProducer, rightPathProducer;
 
     bool shouldShowFFTAnalysis = true;
+    bool isConsumingAnalyzerData = false;
+    bool shouldShowBandOverlay = false;
+    bool shouldShowWaterfall = false;
+    bool shouldShowGainReductionHistory = false;
+
+    /*
+     the waterfall takes the whole analysis area: the crossover, threshold and gain
+     reduction overlays and the gain reduction history are neither drawn nor tracked over it.
+     */
+    bool isShowingWaterfall() const { return shouldShowFFTAnalysis && shouldShowWaterfall; }
+
+    GainReductionGraph gainReductionGraph;
+
+    void updateAnalyzerConsumption();
 
     void drawFFTAnalysis(juce::Graphics& g, juce::Rectangle<int> bounds);
 
+    void drawWaterfall(juce::Graphics& g, juce::Rectangle<int> bounds);
+
     void drawCrossovers(juce::Graphics& g, juce::Rectangle<int> bounds);
 
+    /*
+     each band's gain reduction, drawn as a bar hanging from the top of its
+     frequency range, on the same dB scale as the spectrum.
+     */
+    void drawGainReduction(juce::Graphics& g, juce::Rectangle<int> bounds);
+
+    /*
+     reads the band telemetry and repaints the top strip when a bar moved.
+     returns true when it did.
+     */
+    bool updateGainReduction(juce::Rectangle<int> analysisArea);
+
+    float getGainReductionHeight(float gainReduction, juce::Rectangle<int> analysisArea) const;
+
+    std::array<float, SimpleMBCompAudioProcessor::NumBands> gainReductions{};
+
+    /*
+     where the crossover and threshold lines were last painted,
+     so a parameter change only repaints the strips that moved.
+     */
+    struct OverlayGeometry
+    {
+        float lowMidX = 0.f, midHighX = 0.f;
+        float lowThresholdY = 0.f, midThresholdY = 0.f, highThresholdY = 0.f;
+    };
+
+    OverlayGeometry computeOverlayGeometry(juce::Rectangle<int> analysisArea) const;
+    bool repaintOverlayChanges(juce::Rectangle<int> analysisArea);
+
+    OverlayGeometry paintedOverlay;
+
+    /*
+     called once per display refresh. the spectrum is polled at the display rate while
+     it moves, and only every 'IdleFrameDivider' refreshes once it has been static for
+     'IdleFramesBeforeBackOff' refreshes.
+     */
+    void onVBlank();
+
+    static constexpr int IdleFramesBeforeBackOff = 30;
+    static constexpr int IdleFrameDivider = 4;
+    int idleFrames = 0;
+    int vBlankCounter = 0;
+
     juce::AudioParameterFloat* lowMidXoverParam{ nullptr };
     juce::AudioParameterFloat* midHighXoverParam{ nullptr };
 
     juce::AudioParameterFloat* lowThresholdParam{ nullptr };
     juce::AudioParameterFloat* midThresholdParam{ nullptr };
     juce::AudioParameterFloat* highThresholdParam{ nullptr };
+
+    // declared last: it can fire as soon as it exists, once everything above is constructed
+    juce::VBlankAttachment vBlankAttachment{ this, [this] { onVBlank(); } };
 };
\ No newline at end of file
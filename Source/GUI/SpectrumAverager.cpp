@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    SpectrumAverager.cpp
+    Created: 18 Oct 2026 3:02:44pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "SpectrumAverager.h"
+#include "../DSP/Multiversion.h"
+
+//==============================================================================
+namespace
+{
+    // branch-free, so the loop is vectorized, for every instruction set it is cloned for
+    SIMPLEMBCOMP_TARGET_CLONES
+    void averageAndHoldPeaks(const float* frame, float* avg, float* pk, float* remaining, int numBins,
+                             float alpha, float fall, float hold, float frameInterval)
+    {
+        for (int i = 0; i < numBins; ++i)
+        {
+            auto x = frame[i];
+
+            avg[i] += alpha * (x - avg[i]);
+
+            auto held = remaining[i] - frameInterval;
+            auto fallen = pk[i] - fall;
+
+            // keeps the peak while it is held, lets it fall afterwards
+            auto decayed = juce::jmax(fallen, held < 0.f ? fallen : pk[i]);
+
+            auto isNewPeak = decayed < x;
+            pk[i] = isNewPeak ? x : decayed;
+            remaining[i] = isNewPeak ? hold : held;
+        }
+    }
+}
+
+//==============================================================================
+void SpectrumAverager::prepare(int maxNumBins)
+{
+    average.resize(maxNumBins, 0.f);
+    peak.resize(maxNumBins, 0.f);
+    holdRemaining.resize(maxNumBins, 0.f);
+}
+
+void SpectrumAverager::reset(float negativeInfinity)
+{
+    std::fill(average.begin(), average.end(), negativeInfinity);
+    std::fill(peak.begin(), peak.end(), negativeInfinity);
+    std::fill(holdRemaining.begin(), holdRemaining.end(), 0.f);
+}
+
+void SpectrumAverager::process(const float* frame, int numBins, float frameInterval)
+{
+    jassert(numBins <= (int)average.size());
+    numBins = juce::jmin(numBins, (int)average.size());
+
+    // one-pole smoothing, with the coefficient matched to the actual frame interval
+    const auto alpha = averagingTime > 0.f ? 1.f - std::exp(-frameInterval / averagingTime) : 1.f;
+    const auto fall = peakFallRate * frameInterval;
+
+    averageAndHoldPeaks(frame, average.data(), peak.data(), holdRemaining.data(), numBins,
+                        alpha, fall, peakHoldTime, frameInterval);
+}
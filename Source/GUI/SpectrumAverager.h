@@ -0,0 +1,46 @@
+/*
+  ==============================================================================
+
+    SpectrumAverager.h
+    Created: 18 Oct 2026 3:02:44pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ smooths successive FFT frames (in dB) over time.
+ keeps an exponential average of every bin, plus a peak that is held for
+ 'peakHoldTime' and then falls at 'peakFallRate' dB per second.
+*/
+struct SpectrumAverager
+{
+    void prepare(int maxNumBins);
+
+    /*
+     forgets the history, e.g. after the number of bins changed.
+     */
+    void reset(float negativeInfinity);
+
+    void setAveragingTime(float seconds) { averagingTime = juce::jmax(0.f, seconds); }
+    void setPeakHoldTime(float seconds) { peakHoldTime = juce::jmax(0.f, seconds); }
+    void setPeakFallRate(float decibelsPerSecond) { peakFallRate = juce::jmax(0.f, decibelsPerSecond); }
+
+    /*
+     feeds one frame of 'numBins' dB values, 'frameInterval' seconds after the previous one.
+     */
+    void process(const float* frame, int numBins, float frameInterval);
+
+    const std::vector<float>& getAverage() const { return average; }
+    const std::vector<float>& getPeak() const { return peak; }
+private:
+    std::vector<float> average, peak, holdRemaining;
+
+    float averagingTime = 0.15f;
+    float peakHoldTime = 1.5f;
+    float peakFallRate = 24.f;
+};
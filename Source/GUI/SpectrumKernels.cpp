@@ -0,0 +1,60 @@
+/*
+  ==============================================================================
+
+    SpectrumKernels.cpp
+    Created: 18 Oct 2026 1:37:51pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "SpectrumKernels.h"
+#include "../DSP/Multiversion.h"
+
+namespace
+{
+    /*
+     log2 of a positive, normal float: the exponent comes from the bits and the
+     mantissa goes through a polynomial that is exact at both ends of [1, 2).
+     max error is below 0.001 dB once scaled to decibels.
+     */
+    inline float fastLog2(float x)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &x, sizeof(float));
+
+        auto exponent = (float)((int)((bits >> 23) & 0xffu) - 127);
+
+        bits = (bits & 0x007fffffu) | 0x3f800000u;
+        float mantissa;
+        std::memcpy(&mantissa, &bits, sizeof(float));
+
+        auto t = mantissa - 1.f;
+        auto correction = 0.43807325f + t * (-0.23669342f + t * 0.08030730f);
+
+        return exponent + t + t * (1.f - t) * correction;
+    }
+}
+
+SIMPLEMBCOMP_TARGET_CLONES
+void magnitudesToDecibels(float* data, int numBins, float scale, float negativeInfinity)
+{
+    // 20 * log10(x) == 20 * log10(2) * log2(x)
+    constexpr auto decibelsPerOctave = 6.0205999f;
+    const auto minimumGain = juce::Decibels::decibelsToGain(negativeInfinity, -1000.f);
+
+    // one pass, no branches and no calls, so the compiler can turn it into SIMD code
+    for (int i = 0; i < numBins; ++i)
+    {
+        auto v = data[i] * scale;
+
+        // magnitudes are never negative, so only NaN and +inf need replacing.
+        // both tests are quiet compares, which the vectorizer turns into blends.
+        v = (v == v) ? v : 0.f;
+        v = (v == std::numeric_limits<float>::infinity()) ? 0.f : v;
+
+        v = juce::jmax(v, minimumGain);
+
+        data[i] = decibelsPerOctave * fastLog2(v);
+    }
+}
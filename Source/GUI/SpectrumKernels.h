@@ -0,0 +1,20 @@
+/*
+  ==============================================================================
+
+    SpectrumKernels.h
+    Created: 18 Oct 2026 1:37:51pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ turns the magnitudes of a frequency-only FFT into decibels, in place.
+ each bin is multiplied by 'scale', NaN/inf become silence, and anything below
+ 'negativeInfinity' is clamped to it, like juce::Decibels::gainToDecibels().
+*/
+void magnitudesToDecibels(float* data, int numBins, float scale, float negativeInfinity);
@@ -27,24 +27,25 @@ enum FFTOrder
     order8192 = 13
 };
 
+/*
+ width of the analyzer's smoothing window, as a fraction of an octave.
+ */
+enum OctaveSmoothing
+{
+    noSmoothing = 0,
+    thirdOctave = 3,
+    sixthOctave = 6,
+    twelfthOctave = 12,
+    twentyFourthOctave = 24
+};
+
 //==============================================================================
 /**
 */
-template<typename Attachment, typename APVTS, typename Params, typename ParamName, typename sliderType>
-void makeAttachment(std::unique_ptr<Attachment>& attachment, APVTS& apvts, const Params& params, const ParamName& name, sliderType& slider)
+template<typename Attachment, typename sliderType>
+void makeAttachment(std::unique_ptr<Attachment>& attachment, juce::RangedAudioParameter& param, sliderType& slider)
 {
-    attachment = std::make_unique<Attachment>(apvts,
-        params.at(name),
-        slider);
-}
-
-template<typename APVTS, typename Params, typename Name>
-juce::RangedAudioParameter& getParam(APVTS& apvts, Params& params, const Name& name)
-{
-    auto param = apvts.getParameter(params.at(name));
-    jassert(param != nullptr);
-
-    return *param;
+    attachment = std::make_unique<Attachment>(param, slider);
 }
 
 juce::String getValString(const juce::RangedAudioParameter& param, bool getLow, juce::String suffix);
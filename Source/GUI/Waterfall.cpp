@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+    Waterfall.cpp
+    Created: 19 Oct 2026 2:58:47pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "Waterfall.h"
+#include "Utilities.h"
+
+//==============================================================================
+Waterfall::Waterfall()
+{
+    using namespace juce;
+
+    ColourGradient gradient(Colours::black, 0.f, 0.f, Colours::white, 1.f, 0.f, false);
+    gradient.addColour(0.25, Colours::darkblue);
+    gradient.addColour(0.5, Colours::purple);
+    gradient.addColour(0.7, Colours::red);
+    gradient.addColour(0.85, Colours::orange);
+    gradient.addColour(0.95, Colours::yellow);
+
+    for (int i = 0; i < ColourTableSize; ++i)
+    {
+        auto colour = gradient.getColourAtPosition(i / double(ColourTableSize - 1));
+        colourTable[i] = colour.getPixelARGB();
+    }
+}
+
+void Waterfall::prepare(int historyLength, int height)
+{
+    image.prepare(historyLength, height, juce::Colours::black);
+
+    // forces the row table to be rebuilt for the new height
+    mappedHeight = 0;
+}
+
+bool Waterfall::pushFrame(const std::vector<float>& frame,
+                          int fftSize,
+                          float binWidth,
+                          float negativeInfinity)
+{
+    if (image.isEmpty())
+    {
+        return false;
+    }
+
+    updateRowMapping(image.getHeight(), fftSize, binWidth);
+
+    const auto toIndex = float(ColourTableSize - 1) / (MAX_DECIBELS - negativeInfinity);
+
+    image.pushColumn([this, &frame, negativeInfinity, toIndex](juce::Image::BitmapData& column)
+    {
+        for (int y = 0; y < column.height; ++y)
+        {
+            const auto& row = rows[y];
+            const auto* bins = frame.data() + row.firstBin;
+
+            auto level = *std::max_element(bins, bins + row.numBins);
+            auto index = juce::jlimit(0, ColourTableSize - 1, int((level - negativeInfinity) * toIndex));
+
+            *reinterpret_cast<juce::PixelARGB*>(column.getLinePointer(y)) = colourTable[index];
+        }
+    });
+
+    return true;
+}
+
+void Waterfall::updateRowMapping(int height, int fftSize, float binWidth)
+{
+    if (height == mappedHeight && fftSize == mappedFFTSize && binWidth == mappedBinWidth)
+    {
+        return;
+    }
+
+    mappedHeight = height;
+    mappedFFTSize = fftSize;
+    mappedBinWidth = binWidth;
+
+    rows.resize(height);
+
+    const int lastBin = fftSize / 2 - 1;
+
+    // fractional bin index at a vertical pixel position, 0 being the top edge
+    auto binPosition = [height, binWidth](float y)
+    {
+        auto frequency = juce::mapToLog10(1.f - y / (float)height, MIN_FREQUENCY, MAX_FREQUENCY);
+        return frequency / binWidth;
+    };
+
+    for (int y = 0; y < height; ++y)
+    {
+        auto& row = rows[y];
+
+        // bins whose position lies in [low, high) belong to this row
+        auto high = binPosition((float)y);
+        auto low = binPosition((float)(y + 1));
+
+        auto first = juce::jlimit(0, lastBin, (int)std::ceil(low));
+        auto last = juce::jlimit(0, lastBin, (int)std::ceil(high) - 1);
+
+        if (last >= first)
+        {
+            row.firstBin = first;
+            row.numBins = last - first + 1;
+        }
+        else
+        {
+            row.firstBin = juce::jlimit(0, lastBin, juce::roundToInt(binPosition(y + 0.5f)));
+            row.numBins = 1;
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    Waterfall.h
+    Created: 19 Oct 2026 2:58:47pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "ScrollingImage.h"
+
+//==============================================================================
+/**
+ time-frequency view of the analyzer: every FFT frame becomes one pixel column,
+ frequency going up on a log scale, level mapped through a colour table.
+ writing a frame costs one column of pixels, independent of the history length.
+*/
+struct Waterfall
+{
+    Waterfall();
+
+    /*
+     'historyLength' frames are kept, drawn 'height' pixels tall. clears the history.
+     */
+    void prepare(int historyLength, int height);
+
+    /*
+     writes 'frame', a spectrum in dB, as the newest column.
+     returns false when there is no history to write to yet.
+     */
+    bool pushFrame(const std::vector<float>& frame,
+                   int fftSize,
+                   float binWidth,
+                   float negativeInfinity);
+
+    void draw(juce::Graphics& g, juce::Rectangle<int> area) const { image.draw(g, area); }
+private:
+    static constexpr int ColourTableSize = 256;
+    std::array<juce::PixelARGB, ColourTableSize> colourTable;
+
+    ScrollingImage image;
+
+    /*
+     the bins shown by one pixel row. rows narrower than a bin show the nearest one.
+     */
+    struct RowBins
+    {
+        int firstBin = 0;
+        int numBins = 1;
+    };
+
+    std::vector<RowBins> rows;
+
+    int mappedHeight = 0;
+    int mappedFFTSize = 0;
+    float mappedBinWidth = 0.f;
+
+    void updateRowMapping(int height, int fftSize, float binWidth);
+};
@@ -15,7 +15,105 @@ SimpleMBCompAudioProcessorEditor::SimpleMBCompAudioProcessorEditor (SimpleMBComp
 {
     setLookAndFeel(&lnf);
 
-    // addAndMakeVisible(controlBar);
+    // the band meters, the gain reduction overlay and its history all read the telemetry
+    audioProcessor.addTelemetryConsumer();
+
+    controlBar.analyzerEnableButton.onClick = [this]()
+    {
+        analyzer.toggleAnalysisEnablement(controlBar.analyzerEnableButton.getToggleState());
+    };
+
+    controlBar.fftOrderSelector.onChange = [this]()
+    {
+        auto multiResolution = controlBar.isMultiResolutionSelected();
+        analyzer.setMultiResolution(multiResolution);
+
+        if (!multiResolution)
+        {
+            analyzer.setFFTOrder(controlBar.getSelectedFFTOrder());
+        }
+    };
+
+    controlBar.smoothingSelector.onChange = [this]()
+    {
+        analyzer.setSmoothing(controlBar.getSelectedSmoothing());
+    };
+
+    controlBar.bandOverlayButton.onClick = [this]()
+    {
+        analyzer.toggleBandOverlay(controlBar.bandOverlayButton.getToggleState());
+    };
+
+    controlBar.waterfallButton.onClick = [this]()
+    {
+        analyzer.toggleWaterfall(controlBar.waterfallButton.getToggleState());
+    };
+
+    controlBar.gainReductionHistoryButton.onClick = [this]()
+    {
+        analyzer.toggleGainReductionHistory(controlBar.gainReductionHistoryButton.getToggleState());
+    };
+
+    using Tap = SimpleMBCompAudioProcessor::AnalyzerTap;
+
+    auto tapId = audioProcessor.getAnalyzerTap() == Tap::PreCompression ? ControlBar::PreCompressionTap :
+                                                                          ControlBar::PostCompressionTap;
+    controlBar.analyzerTapSelector.setSelectedId(tapId, juce::NotificationType::dontSendNotification);
+
+    controlBar.analyzerTapSelector.onChange = [this]()
+    {
+        auto isPre = controlBar.analyzerTapSelector.getSelectedId() == ControlBar::PreCompressionTap;
+        audioProcessor.setAnalyzerTap(isPre ? Tap::PreCompression : Tap::PostCompression);
+    };
+
+    auto& snapshots = audioProcessor.getSnapshots();
+
+    auto& activeButton = snapshots.getActiveSlot() == SnapshotBank::A ? controlBar.snapshotAButton :
+                                                                        controlBar.snapshotBButton;
+    activeButton.setToggleState(true, juce::NotificationType::dontSendNotification);
+
+    auto switchSnapshot = [this](int slot)
+    {
+        audioProcessor.getSnapshots().switchTo(slot, audioProcessor.parameters);
+        controlBar.morphSlider.setValue(slot == SnapshotBank::A ? 0.0 : 1.0, juce::NotificationType::dontSendNotification);
+    };
+
+    controlBar.snapshotAButton.onClick = [this, switchSnapshot]()
+    {
+        if (controlBar.snapshotAButton.getToggleState())
+        {
+            switchSnapshot(SnapshotBank::A);
+        }
+    };
+
+    controlBar.snapshotBButton.onClick = [this, switchSnapshot]()
+    {
+        if (controlBar.snapshotBButton.getToggleState())
+        {
+            switchSnapshot(SnapshotBank::B);
+        }
+    };
+
+    controlBar.morphSlider.setValue(snapshots.getActiveSlot() == SnapshotBank::A ? 0.0 : 1.0,
+                                    juce::NotificationType::dontSendNotification);
+
+    controlBar.morphSlider.onValueChange = [this]()
+    {
+        audioProcessor.getSnapshots().morph(SnapshotBank::A, SnapshotBank::B,
+                                            (float)controlBar.morphSlider.getValue(), audioProcessor.parameters);
+    };
+
+    controlBar.morphSlider.onDragEnd = [this]()
+    {
+        audioProcessor.getSnapshots().commitMorph(audioProcessor.parameters);
+    };
+
+    controlBar.savePresetButton.onClick = [this]()
+    {
+        showSavePresetDialog();
+    };
+
+    addAndMakeVisible(controlBar);
     addAndMakeVisible(analyzer);
     addAndMakeVisible(globalControls);
     addAndMakeVisible(bandControls);
@@ -25,6 +123,7 @@ SimpleMBCompAudioProcessorEditor::SimpleMBCompAudioProcessorEditor (SimpleMBComp
 
 SimpleMBCompAudioProcessorEditor::~SimpleMBCompAudioProcessorEditor()
 {
+    audioProcessor.removeTelemetryConsumer();
     setLookAndFeel(nullptr);
 }
 
@@ -41,6 +140,39 @@ void SimpleMBCompAudioProcessorEditor::paint (juce::Graphics& g)
     g.fillAll(juce::Colours::black);
 }
 
+void SimpleMBCompAudioProcessorEditor::showSavePresetDialog()
+{
+    auto currentProgram = audioProcessor.getCurrentProgram();
+    auto* dialog = new juce::AlertWindow("Save Preset", "Saves the current settings in your preset bank.",
+                                         juce::MessageBoxIconType::NoIcon, this);
+
+    dialog->addTextEditor("name", audioProcessor.getProgramName(currentProgram), "Name");
+    dialog->addButton("Save", 1, juce::KeyPress(juce::KeyPress::returnKey));
+    dialog->addButton("Cancel", 0, juce::KeyPress(juce::KeyPress::escapeKey));
+
+    // the dialog deletes itself once dismissed, after the callback, and may outlive the editor
+    juce::Component::SafePointer<SimpleMBCompAudioProcessorEditor> editor(this);
+
+    dialog->enterModalState(true, juce::ModalCallbackFunction::create([editor, dialog](int result)
+    {
+        auto name = dialog->getTextEditorContents("name").trim();
+
+        if (editor == nullptr || result == 0 || name.isEmpty())
+        {
+            return;
+        }
+
+        if (!editor->audioProcessor.saveUserPreset(name))
+        {
+            juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon, "Save Preset",
+                                                   "The preset could not be written to "
+                                                   + PresetBank::getDefaultFile().getFullPathName()
+                                                   + ", it is only kept until the plugin is closed.",
+                                                   {}, editor.getComponent());
+        }
+    }), true);
+}
+
 void SimpleMBCompAudioProcessorEditor::resized()
 {
     
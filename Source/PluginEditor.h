@@ -15,6 +15,7 @@
 #include "GUI/LookAndFeel.h"
 #include "GUI/utilityComponents.h"
 #include "GUI/SpectrumAnalyzer.h"
+#include "GUI/ControlBar.h"
 
 //==============================================================================
 /**
@@ -30,15 +31,20 @@ public:
     void resized() override;
 
 private:
+    /*
+     asks for a name and saves the current settings under it, see saveUserPreset().
+     */
+    void showSavePresetDialog();
+
     LookAndFeel lnf;
 
     // This reference is provided as a quick way for your editor to
     // access the processor object that created it.
     SimpleMBCompAudioProcessor& audioProcessor;
 
-    Placeholder controlBar /* , analyzer, globalControls, bandControls */ ;
-    GlobalControls globalControls{ audioProcessor.apvts };
-    CompressorBandControls bandControls{ audioProcessor.apvts };
+    ControlBar controlBar;
+    GlobalControls globalControls{ audioProcessor.parameters };
+    CompressorBandControls bandControls{ audioProcessor };
     SpectrumAnalyzer analyzer{ audioProcessor };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SimpleMBCompAudioProcessorEditor)
@@ -8,6 +8,8 @@
 
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "DSP/FactoryPresets.h"
+#include "DSP/StateFormat.h"
 
 //==============================================================================
 SimpleMBCompAudioProcessor::SimpleMBCompAudioProcessor()
@@ -23,66 +25,50 @@ SimpleMBCompAudioProcessor::SimpleMBCompAudioProcessor()
 #endif
 {
     using namespace Params;
-    const auto& params = GetParams();
-    
-    auto floatHelper = [&apvts = this->apvts, &params](auto& param, const auto& paramName)
+
+    auto bindBand = [](CompressorBand& band, Names attack, Names release, Names threshold,
+                       Names ratio, Names bypassed, Names mute, Names solo)
     {
-        param = dynamic_cast<juce::AudioParameterFloat*>(apvts.getParameter(params.at(paramName)));
-        jassert(param != nullptr);
+        band.attack = attack;
+        band.release = release;
+        band.threshold = threshold;
+        band.ratio = ratio;
+        band.bypassed = bypassed;
+        band.mute = mute;
+        band.solo = solo;
     };
 
-    auto choiceHelper = [&apvts = this->apvts, &params](auto& param, const auto& paramName)
+    bindBand(lowBandComp,
+             Names::Attack_Low_Band, Names::Release_Low_Band, Names::Threshold_Low_Band, Names::Ratio_Low_Band,
+             Names::Bypassed_Low_Band, Names::Mute_Low_Band, Names::Solo_Low_Band);
+
+    bindBand(midBandComp,
+             Names::Attack_Mid_Band, Names::Release_Mid_Band, Names::Threshold_Mid_Band, Names::Ratio_Mid_Band,
+             Names::Bypassed_Mid_Band, Names::Mute_Mid_Band, Names::Solo_Mid_Band);
+
+    bindBand(highBandComp,
+             Names::Attack_High_Band, Names::Release_High_Band, Names::Threshold_High_Band, Names::Ratio_High_Band,
+             Names::Bypassed_High_Band, Names::Mute_High_Band, Names::Solo_High_Band);
+
+    // the factory presets until the user saves one, which writes them into the user's bank too
+    if (!presetBank.open(PresetBank::getDefaultFile()))
     {
-        param = dynamic_cast<juce::AudioParameterChoice*>(apvts.getParameter(params.at(paramName)));
-        jassert(param != nullptr);
-    };
+        presetBank.openInMemory(FactoryPresets::create());
+    }
+
+   #if SIMPLEMBCOMP_PROFILING
+    // with the variable set before the host starts, every instance traces itself into that directory
+    auto traceDirectory = juce::SystemStats::getEnvironmentVariable("SIMPLEMBCOMP_TRACE_DIR", {});
 
-    auto boolHelper = [&apvts = this->apvts, &params](auto& param, const auto& paramName)
+    if (traceDirectory.isNotEmpty())
     {
-        param = dynamic_cast<juce::AudioParameterBool*>(apvts.getParameter(params.at(paramName)));
-        jassert(param != nullptr);
-    };
+        auto traceFile = juce::File::getCurrentWorkingDirectory()
+            .getChildFile(traceDirectory)
+            .getNonexistentChildFile("SimpleMBComp", ".json");
 
-    /* Low Band Parameters */
-    floatHelper(lowBandComp.attack,    Names::Attack_Low_Band);
-    floatHelper(lowBandComp.release,   Names::Release_Low_Band);
-    floatHelper(lowBandComp.threshold, Names::Threshold_Low_Band);
-    choiceHelper(lowBandComp.ratio,    Names::Ratio_Low_Band);
-    boolHelper(lowBandComp.bypassed,   Names::Bypassed_Low_Band);
-    boolHelper(lowBandComp.mute,       Names::Mute_Low_Band);
-    boolHelper(lowBandComp.solo,       Names::Solo_Low_Band);
-
-    /* Mid Band Parameters */
-    floatHelper(midBandComp.attack,    Names::Attack_Mid_Band);
-    floatHelper(midBandComp.release,   Names::Release_Mid_Band);
-    floatHelper(midBandComp.threshold, Names::Threshold_Mid_Band);
-    choiceHelper(midBandComp.ratio,    Names::Ratio_Mid_Band);
-    boolHelper(midBandComp.bypassed,   Names::Bypassed_Mid_Band);
-    boolHelper(midBandComp.mute,       Names::Mute_Mid_Band);
-    boolHelper(midBandComp.solo,       Names::Solo_Mid_Band);
-
-    /* High Band Parameters */
-    floatHelper(highBandComp.attack,    Names::Attack_High_Band);
-    floatHelper(highBandComp.release,   Names::Release_High_Band);
-    floatHelper(highBandComp.threshold, Names::Threshold_High_Band);
-    choiceHelper(highBandComp.ratio,    Names::Ratio_High_Band);
-    boolHelper(highBandComp.bypassed,   Names::Bypassed_High_Band);
-    boolHelper(highBandComp.mute,       Names::Mute_High_Band);
-    boolHelper(highBandComp.solo,       Names::Solo_High_Band);
-
-    floatHelper(lowMidCrossover,  Names::Low_Mid_Crossover_Freq);
-    floatHelper(midHighCrossover, Names::Mid_High_Crossover_Freq);
-
-    floatHelper(inputGainParam, Names::Gain_In);
-    floatHelper(outputGainParam, Names::Gain_Out);
-
-    LP1.setType(juce::dsp::LinkwitzRileyFilterType::lowpass);
-    HP1.setType(juce::dsp::LinkwitzRileyFilterType::highpass);
-
-    AP2.setType(juce::dsp::LinkwitzRileyFilterType::allpass);
-
-    LP2.setType(juce::dsp::LinkwitzRileyFilterType::lowpass);
-    HP2.setType(juce::dsp::LinkwitzRileyFilterType::highpass);
+        profiler.startRecording(traceFile);
+    }
+   #endif
 }
 
 SimpleMBCompAudioProcessor::~SimpleMBCompAudioProcessor()
@@ -129,26 +115,47 @@ double SimpleMBCompAudioProcessor::getTailLengthSeconds() const
 
 int SimpleMBCompAudioProcessor::getNumPrograms()
 {
-    return 1;   // NB: some hosts don't cope very well if you tell them there are 0 programs,
-                // so this should be at least 1, even if you're not really implementing programs.
+    // NB: some hosts don't cope very well if you tell them there are 0 programs,
+    // so this should be at least 1, even without a preset bank.
+    return juce::jmax(1, presetBank.getNumPresets());
 }
 
 int SimpleMBCompAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram.load();
 }
 
 void SimpleMBCompAudioProcessor::setCurrentProgram (int index)
 {
+    if (!juce::isPositiveAndBelow(index, presetBank.getNumPresets()))
+    {
+        return;
+    }
+
+    currentProgram.store(index);
+    presetLoader.load(index);
 }
 
 const juce::String SimpleMBCompAudioProcessor::getProgramName (int index)
 {
-    return {};
+    return presetBank.getName(index);
 }
 
 void SimpleMBCompAudioProcessor::changeProgramName (int index, const juce::String& newName)
 {
+    // presets are named when they are saved, see saveUserPreset()
+    juce::ignoreUnused(index, newName);
+}
+
+bool SimpleMBCompAudioProcessor::saveUserPreset(const juce::String& name)
+{
+    PresetBank::Preset preset{ name, {} };
+    StateFormat::write(parameters, preset.state);
+
+    currentProgram.store(presetBank.add(preset));
+    updateHostDisplay(juce::AudioProcessorListener::ChangeDetails().withProgramChanged(true));
+
+    return presetBank.save(PresetBank::getDefaultFile());
 }
 
 //==============================================================================
@@ -165,11 +172,7 @@ void SimpleMBCompAudioProcessor::prepareToPlay (double sampleRate, int samplesPe
         compressor.prepare(spec);
     }
 
-    LP1.prepare(spec);
-    HP1.prepare(spec);
-    AP2.prepare(spec);
-    LP2.prepare(spec);
-    HP2.prepare(spec);
+    crossover.prepare(spec);
 
     for (auto& buffer : filterBuffers)
     {
@@ -182,6 +185,18 @@ void SimpleMBCompAudioProcessor::prepareToPlay (double sampleRate, int samplesPe
 
     inputGain.setRampDurationSeconds(0.05);
     outputGain.setRampDurationSeconds(0.05);
+
+    snapshots.prepare(sampleRate, parameters);
+
+    // the first block runs at the current settings: without this the gains would ramp
+    // from wherever the previous run left them, or from silence the first time
+    parameters.readValues(blockValues);
+    applySettings(blockValues);
+    inputGain.reset();
+    outputGain.reset();
+
+    leftChannelFifo.prepare(samplesPerBlock);
+    rightChannelFifo.prepare(samplesPerBlock);
 }
 
 void SimpleMBCompAudioProcessor::releaseResources()
@@ -216,77 +231,40 @@ bool SimpleMBCompAudioProcessor::isBusesLayoutSupported (const BusesLayout& layo
 }
 #endif
 
-void SimpleMBCompAudioProcessor::updateState()
+void SimpleMBCompAudioProcessor::updateState(int numSamples)
+{
+    // the parameters, or the snapshot move in progress
+    snapshots.getBlockValues(parameters, blockValues, numSamples);
+    applySettings(blockValues);
+}
+
+void SimpleMBCompAudioProcessor::applySettings(const Params::Values& values)
 {
     for (auto& compressor : compressors)
     {
-        compressor.updateCompressorSettings();
+        compressor.updateCompressorSettings(values);
     }
 
-    auto lowMidCutoffFreq = lowMidCrossover->get();
-    LP1.setCutoffFrequency(lowMidCutoffFreq);
-    HP1.setCutoffFrequency(lowMidCutoffFreq);
-
-    auto midHighCutoffFreq = midHighCrossover->get();
-    AP2.setCutoffFrequency(midHighCutoffFreq);
-    LP2.setCutoffFrequency(midHighCutoffFreq);
-    HP2.setCutoffFrequency(midHighCutoffFreq);
+    crossover.setCutoffFrequencies(values[Params::Low_Mid_Crossover_Freq],
+                                   values[Params::Mid_High_Crossover_Freq]);
 
-    inputGain.setGainDecibels(inputGainParam->get());
-    outputGain.setGainDecibels(outputGainParam->get());
+    inputGain.setGainDecibels(values[Params::Gain_In]);
+    outputGain.setGainDecibels(values[Params::Gain_Out]);
 }
 
 void SimpleMBCompAudioProcessor::splitBands(const juce::AudioBuffer<float>& inputBuffer)
 {
-    for (auto& fb : filterBuffers)
-    {
-        fb = inputBuffer;
-    }
-
-    auto fb0Block = juce::dsp::AudioBlock<float>(filterBuffers[0]);
-    auto fb1Block = juce::dsp::AudioBlock<float>(filterBuffers[1]);
-    auto fb2Block = juce::dsp::AudioBlock<float>(filterBuffers[2]);
-
-    auto fb0Ctx = juce::dsp::ProcessContextReplacing<float>(fb0Block);
-    auto fb1Ctx = juce::dsp::ProcessContextReplacing<float>(fb1Block);
-    auto fb2Ctx = juce::dsp::ProcessContextReplacing<float>(fb2Block);
-
-    LP1.process(fb0Ctx);
-    AP2.process(fb0Ctx);
-
-    HP1.process(fb1Ctx);
-    filterBuffers[2] = filterBuffers[1];
-    LP2.process(fb1Ctx);
-
-    HP2.process(fb2Ctx);
+    crossover.process(inputBuffer, filterBuffers);
 }
 
-void SimpleMBCompAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+void SimpleMBCompAudioProcessor::pushToAnalyzer(const BlockType& buffer)
 {
-    juce::ScopedNoDenormals noDenormals;
-    auto totalNumInputChannels  = getTotalNumInputChannels();
-    auto totalNumOutputChannels = getTotalNumOutputChannels();
-
-    // In case we have more outputs than inputs, this code clears any output
-    // channels that didn't contain input data, (because these aren't
-    // guaranteed to be empty - they may contain garbage).
-    // This is here to avoid people getting screaming feedback
-    // when they first compile a plugin, but obviously you don't need to keep
-    // this code if your algorithm always overwrites all the output channels.
-    for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
-        buffer.clear (i, 0, buffer.getNumSamples());
-
-    updateState();
-
-    applyGain(buffer, inputGain);
-
-    splitBands(buffer);
-
-    for (size_t i = 0; i < filterBuffers.size(); ++i)
-    {
-        compressors[i].process(filterBuffers[i]);
-    }
+    leftChannelFifo.update(buffer);
+    rightChannelFifo.update(buffer);
+}
 
+void SimpleMBCompAudioProcessor::mixBands(juce::AudioBuffer<float>& buffer)
+{
     auto numSamples = buffer.getNumSamples();
     auto numChannels = buffer.getNumChannels();
 
@@ -303,7 +281,7 @@ void SimpleMBCompAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     auto bandsAreSoloed = false;
     for (auto& comp : compressors)
     {
-        if (comp.solo->get())
+        if (comp.isSoloed())
         {
             bandsAreSoloed = true;
             break;
@@ -315,7 +293,7 @@ void SimpleMBCompAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
         for (size_t i = 0; i < compressors.size(); ++i)
         {
             auto& comp = compressors[i];
-            if (comp.solo->get())
+            if (comp.isSoloed())
             {
                 addFilterBand(buffer, filterBuffers[i]);
             }
@@ -326,14 +304,82 @@ void SimpleMBCompAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
         for (size_t i = 0; i < compressors.size(); ++i)
         {
             auto& comp = compressors[i];
-            if (!comp.mute->get())
+            if (!comp.isMuted())
             {
                 addFilterBand(buffer, filterBuffers[i]);
             }
         }
     }
+}
+
+void SimpleMBCompAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ScopedNoDenormals noDenormals;
+    auto totalNumInputChannels  = getTotalNumInputChannels();
+    auto totalNumOutputChannels = getTotalNumOutputChannels();
+
+    // In case we have more outputs than inputs, this code clears any output
+    // channels that didn't contain input data, (because these aren't
+    // guaranteed to be empty - they may contain garbage).
+    // This is here to avoid people getting screaming feedback
+    // when they first compile a plugin, but obviously you don't need to keep
+    // this code if your algorithm always overwrites all the output channels.
+    for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
+        buffer.clear (i, 0, buffer.getNumSamples());
+
+   #if SIMPLEMBCOMP_PROFILING
+    if (profiler.isRecording())
+    {
+        Profiling::StageProfiler::Timer timer(profiler);
+        processStages(buffer, timer);
+        return;
+    }
+   #endif
+
+    Profiling::NoTimer timer;
+    processStages(buffer, timer);
+}
+
+template<typename Timer>
+void SimpleMBCompAudioProcessor::processStages(juce::AudioBuffer<float>& buffer, Timer& timer)
+{
+    updateState(buffer.getNumSamples());
+    timer.lap(Profiling::Stage::UpdateState);
+
+    // read once per block, so a tap is never half-fed
+    const auto feedAnalyzer = isFeedingAnalyzer();
+    const auto tap = analyzerTap.load(std::memory_order_relaxed);
+    const auto feedTelemetry = isFeedingTelemetry();
+
+    applyGain(buffer, inputGain);
+    timer.lap(Profiling::Stage::InputGain);
+
+    if (feedAnalyzer && tap == AnalyzerTap::PreCompression)
+    {
+        pushToAnalyzer(buffer);
+        timer.lap(Profiling::Stage::AnalyzerTap);
+    }
+
+    splitBands(buffer);
+    timer.lap(Profiling::Stage::SplitBands);
+
+    for (size_t i = 0; i < filterBuffers.size(); ++i)
+    {
+        compressors[i].process(filterBuffers[i], feedTelemetry);
+        timer.lap(Profiling::bandStage(i));
+    }
+
+    mixBands(buffer);
+    timer.lap(Profiling::Stage::MixBands);
 
     applyGain(buffer, outputGain);
+    timer.lap(Profiling::Stage::OutputGain);
+
+    if (feedAnalyzer && tap == AnalyzerTap::PostCompression)
+    {
+        pushToAnalyzer(buffer);
+        timer.lap(Profiling::Stage::AnalyzerTap);
+    }
 }
 
 //==============================================================================
@@ -351,12 +397,17 @@ juce::AudioProcessorEditor* SimpleMBCompAudioProcessor::createEditor()
 //==============================================================================
 void SimpleMBCompAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
-    juce::MemoryOutputStream mos(destData, true);
-    apvts.state.writeToStream(mos);
+    StateFormat::write(parameters, destData);
 }
 
 void SimpleMBCompAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
+    if (StateFormat::read(parameters, data, sizeInBytes))
+    {
+        return;
+    }
+
+    // sessions saved before the binary format hold the whole ValueTree
     auto tree = juce::ValueTree::readFromData(data, sizeInBytes);
     if (tree.isValid())
     {
@@ -364,141 +415,52 @@ void SimpleMBCompAudioProcessor::setStateInformation (const void* data, int size
     }
 }
 
+// the table lives with the DSP, these are the GUI's names for the same bounds
+static_assert(Params::Table[Params::Threshold_Low_Band].minimum == MIN_THRESHOLD, "threshold range out of sync");
+static_assert(Params::Table[Params::Threshold_Low_Band].maximum == MAX_DECIBELS, "threshold range out of sync");
+static_assert(Params::Table[Params::Low_Mid_Crossover_Freq].minimum == MIN_FREQUENCY, "crossover range out of sync");
+static_assert(Params::Table[Params::Mid_High_Crossover_Freq].maximum == MAX_FREQUENCY, "crossover range out of sync");
+
 juce::AudioProcessorValueTreeState::ParameterLayout SimpleMBCompAudioProcessor::createParameterLayout()
 {
     APVTS::ParameterLayout layout;
 
     using namespace juce;
     using namespace Params;
-    const auto& params = GetParams();
-
-    auto gainRange = NormalisableRange<float>(-24.f, 24.f, 0.5f, 1.f);
-
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Gain_In),
-                                                     params.at(Names::Gain_In),
-                                                     gainRange,
-                                                     0.f));
-
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Gain_Out),
-                                                     params.at(Names::Gain_Out),
-                                                     gainRange,
-                                                     0.f));
-
-    auto thresholdRange = NormalisableRange<float>(MIN_THRESHOLD, MAX_DECIBELS, 1, 1);
-
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Threshold_Low_Band),
-                                                     params.at(Names::Threshold_Low_Band),
-                                                     thresholdRange,
-                                                     0.f));
-
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Threshold_Mid_Band),
-                                                     params.at(Names::Threshold_Mid_Band),
-                                                     thresholdRange,
-                                                     0.f));
-
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Threshold_High_Band),
-                                                     params.at(Names::Threshold_High_Band),
-                                                     thresholdRange,
-                                                     0.f));
-
-    auto attackReleaseRange = NormalisableRange<float>(5.0, 500.0, 1, 1);
-
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Attack_Low_Band),
-                                                     params.at(Names::Attack_Low_Band),
-                                                     attackReleaseRange,
-                                                     50.f));
-    
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Attack_Mid_Band),
-                                                     params.at(Names::Attack_Mid_Band),
-                                                     attackReleaseRange,
-                                                     50.f));
- 
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Attack_High_Band),
-                                                     params.at(Names::Attack_High_Band),
-                                                     attackReleaseRange,
-                                                     50.f));
-
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Release_Low_Band),
-                                                     params.at(Names::Release_Low_Band),
-                                                     attackReleaseRange,
-                                                     250.f));
-
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Release_Mid_Band),
-                                                     params.at(Names::Release_Mid_Band),
-                                                     attackReleaseRange,
-                                                     250.f));
-
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Release_High_Band),
-                                                     params.at(Names::Release_High_Band),
-                                                     attackReleaseRange,
-                                                     250.f));
-
-    auto choices = std::vector<double>{ 1, 1.5, 2, 3, 4, 5, 6, 7, 8, 10, 15, 20, 50, 100 };
-    juce::StringArray sa;
-    for (auto choice : choices)
+    const auto& ids = GetParams();
+
+    StringArray ratioChoices;
+    for (auto choice : RatioChoices)
     {
-        sa.add(String(choice, 1));
+        ratioChoices.add(String(choice, 1));
     }
 
-    layout.add(std::make_unique<AudioParameterChoice>(params.at(Names::Ratio_Low_Band),
-                                                      params.at(Names::Ratio_Low_Band),
-                                                      sa,
-                                                      3));
-    layout.add(std::make_unique<AudioParameterChoice>(params.at(Names::Ratio_Mid_Band),
-                                                      params.at(Names::Ratio_Mid_Band),
-                                                      sa,
-                                                      3));
-
-    layout.add(std::make_unique<AudioParameterChoice>(params.at(Names::Ratio_High_Band),
-                                                      params.at(Names::Ratio_High_Band),
-                                                      sa,
-                                                      3));
-
-    layout.add(std::make_unique<AudioParameterBool>(params.at(Names::Bypassed_Low_Band),
-                                                    params.at(Names::Bypassed_Low_Band),
-                                                    false));
-
-    layout.add(std::make_unique<AudioParameterBool>(params.at(Names::Bypassed_Mid_Band),
-                                                    params.at(Names::Bypassed_Mid_Band),
-                                                    false));
-
-    layout.add(std::make_unique<AudioParameterBool>(params.at(Names::Bypassed_High_Band),
-                                                    params.at(Names::Bypassed_High_Band),
-                                                    false));
-
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Low_Mid_Crossover_Freq),
-                                                     params.at(Names::Low_Mid_Crossover_Freq),
-                                                     NormalisableRange<float>(MIN_FREQUENCY, 999, 1, 1),
-                                                     400));
-
-    layout.add(std::make_unique<AudioParameterFloat>(params.at(Names::Mid_High_Crossover_Freq),
-                                                     params.at(Names::Mid_High_Crossover_Freq),
-                                                     NormalisableRange<float>(1000, MAX_FREQUENCY, 1, 1),
-                                                     2000));
-
-    layout.add(std::make_unique<AudioParameterBool>(params.at(Names::Mute_Low_Band),
-                                                    params.at(Names::Mute_Low_Band),
-                                                    false));
-
-    layout.add(std::make_unique<AudioParameterBool>(params.at(Names::Mute_Mid_Band),
-                                                    params.at(Names::Mute_Mid_Band),
-                                                    false));
-
-    layout.add(std::make_unique<AudioParameterBool>(params.at(Names::Mute_High_Band),
-                                                    params.at(Names::Mute_High_Band),
-                                                    false));
-
-    layout.add(std::make_unique<AudioParameterBool>(params.at(Names::Solo_Low_Band),
-                                                    params.at(Names::Solo_Low_Band),
-                                                    false));
-
-    layout.add(std::make_unique<AudioParameterBool>(params.at(Names::Solo_Mid_Band),
-                                                    params.at(Names::Solo_Mid_Band),
-                                                    false));
-
-    layout.add(std::make_unique<AudioParameterBool>(params.at(Names::Solo_High_Band),
-                                                    params.at(Names::Solo_High_Band),
-                                                    false));
+    for (auto name : HostOrder)
+    {
+        const auto& spec = Table[name];
+        const auto& id = ids[name];
+
+        switch (spec.kind)
+        {
+        case Kind::Float:
+            layout.add(std::make_unique<AudioParameterFloat>(id,
+                                                             id,
+                                                             NormalisableRange<float>(spec.minimum, spec.maximum, spec.interval, spec.skew),
+                                                             spec.defaultValue));
+            break;
+        case Kind::Choice:
+            layout.add(std::make_unique<AudioParameterChoice>(id,
+                                                              id,
+                                                              ratioChoices,
+                                                              (int)spec.defaultValue));
+            break;
+        case Kind::Bool:
+            layout.add(std::make_unique<AudioParameterBool>(id,
+                                                            id,
+                                                            spec.defaultValue != 0.f));
+            break;
+        }
+    }
 
     return layout;
 }
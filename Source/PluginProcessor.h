@@ -12,6 +12,11 @@
 #include <array>
 #include "DSP/Params.h"
 #include "DSP/CompressorBand.h"
+#include "DSP/Crossover.h"
+#include "DSP/SnapshotBank.h"
+#include "DSP/PresetBank.h"
+#include "DSP/PresetLoader.h"
+#include "DSP/StageProfiler.h"
 #include "DSP/SingleChannelSampleFifo.h"
 
 //==============================================================================
@@ -62,31 +67,86 @@ public:
     
     APVTS apvts{ *this, nullptr, "Parameters", createParameterLayout() };
 
+    /*
+     typed access to every parameter, resolved once after apvts created them.
+     */
+    const Params::Handles parameters{ *this };
+
     using BlockType = juce::AudioBuffer<float>;
     SingleChannelSampleFifo<BlockType> leftChannelFifo{ Channel::Left };
     SingleChannelSampleFifo<BlockType> rightChannelFifo{ Channel::Right };
 
+    enum class AnalyzerTap
+    {
+        PreCompression,
+        PostCompression
+    };
+
+    void setAnalyzerTap(AnalyzerTap tap) { analyzerTap.store(tap); }
+    AnalyzerTap getAnalyzerTap() const { return analyzerTap.load(); }
+
+    /*
+     the fifos above are only fed while at least one consumer (an open analyzer) is registered,
+     so instances without an editor skip the analyzer taps entirely.
+     */
+    void addAnalyzerConsumer() { analyzerConsumers.fetch_add(1); }
+    void removeAnalyzerConsumer() { analyzerConsumers.fetch_sub(1); }
+    bool isFeedingAnalyzer() const { return analyzerConsumers.load(std::memory_order_relaxed) > 0; }
+
+    static constexpr int NumBands = 3;
+
+    /*
+     the band telemetry and gain reduction histories are only measured while at least one
+     consumer (an open editor) is registered, like the analyzer fifos.
+     */
+    void addTelemetryConsumer() { telemetryConsumers.fetch_add(1); }
+    void removeTelemetryConsumer() { telemetryConsumers.fetch_sub(1); }
+    bool isFeedingTelemetry() const { return telemetryConsumers.load(std::memory_order_relaxed) > 0; }
+
+    /*
+     levels and gain reduction of each band's compressor, lowest band first.
+     */
+    const BandTelemetry& getBandTelemetry(int band) const { return compressors[band].getTelemetry(); }
+
+    const GainReductionHistory& getGainReductionHistory(int band) const { return compressors[band].getGainReductionHistory(); }
+
+    /*
+     A/B and the snapshot bank. message thread only, together with 'parameters'.
+     */
+    SnapshotBank& getSnapshots() { return snapshots; }
+
+    /*
+     message thread: saves the current settings in the user's bank as 'name', replacing a
+     preset of that name, and makes it the current program. false if the bank could not
+     be written, the preset is still a program until the plugin is reloaded.
+     */
+    bool saveUserPreset(const juce::String& name);
+
+   #if SIMPLEMBCOMP_PROFILING
+    /*
+     the per-stage trace of this instance. message thread only.
+     */
+    Profiling::StageProfiler& getProfiler() { return profiler; }
+   #endif
+
 private:
+    std::atomic<int> analyzerConsumers{ 0 };
+    std::atomic<int> telemetryConsumers{ 0 };
+    std::atomic<AnalyzerTap> analyzerTap{ AnalyzerTap::PostCompression };
 
-    std::array<CompressorBand, 3> compressors;
+    void pushToAnalyzer(const BlockType& buffer);
+
+
+    std::array<CompressorBand, NumBands> compressors;
     CompressorBand& lowBandComp = compressors[0];
     CompressorBand& midBandComp = compressors[1];
     CompressorBand& highBandComp = compressors[2];
 
-    using Filter = juce::dsp::LinkwitzRileyFilter<float>;
-    
-    //     fc0  fc1
-    Filter LP1, AP2,
-           HP1, LP2,
-                HP2;
+    Crossover crossover;
 
-    juce::AudioParameterFloat* lowMidCrossover{ nullptr };
-    juce::AudioParameterFloat* midHighCrossover{ nullptr };
-    std::array<juce::AudioBuffer<float>, 3> filterBuffers;
+    std::array<juce::AudioBuffer<float>, Crossover::NumBands> filterBuffers;
 
     juce::dsp::Gain<float> inputGain, outputGain;
-    juce::AudioParameterFloat* inputGainParam{ nullptr };
-    juce::AudioParameterFloat* outputGainParam{ nullptr };
 
     template<typename T, typename U>
     void applyGain(T& buffer, U& gain)
@@ -97,10 +157,40 @@ private:
         gain.process(ctx);
     }
 
-    void updateState();
+    SnapshotBank snapshots;
+
+    // what this block runs with, see updateState()
+    Params::Values blockValues{};
+
+    // the programs the host sees
+    PresetBank presetBank;
+    PresetLoader presetLoader{ presetBank, snapshots, parameters };
+    std::atomic<int> currentProgram{ 0 };
+
+    void updateState(int numSamples);
+    void applySettings(const Params::Values& values);
+
+    /*
+     everything processBlock does after clearing the extra outputs. 'timer' gets a lap
+     after every stage: a Profiling::NoTimer, unless a trace is being recorded.
+     */
+    template<typename Timer>
+    void processStages(juce::AudioBuffer<float>& buffer, Timer& timer);
 
     void splitBands(const juce::AudioBuffer<float>& inputBuffer);
 
+    /*
+     sums the compressed bands back into 'buffer', honouring mute and solo.
+     */
+    void mixBands(juce::AudioBuffer<float>& buffer);
+
+   #if SIMPLEMBCOMP_PROFILING
+    Profiling::StageProfiler profiler;
+   #endif
+
+    // times the stages above one by one
+    friend struct ProcessorStageBenchmark;
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SimpleMBCompAudioProcessor)
 };
@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+
+    BatchRenderer.cpp
+    Created: 21 Oct 2026 2:37:50pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include "BatchRenderer.h"
+
+//==============================================================================
+RenderWorker::RenderWorker(const RenderSettings& renderSettings,
+                           const juce::Array<RenderInput>& inputFiles,
+                           std::atomic<int>& next,
+                           std::function<void(const RenderResult&)> onDone) :
+    juce::ThreadPoolJob("render worker"),
+    settings(renderSettings),
+    inputs(inputFiles),
+    nextInput(next),
+    onFileDone(std::move(onDone))
+{
+    formats.registerBasicFormats();
+}
+
+juce::ThreadPoolJob::JobStatus RenderWorker::runJob()
+{
+    for (auto index = nextInput.fetch_add(1); index < inputs.size(); index = nextInput.fetch_add(1))
+    {
+        if (shouldExit())
+        {
+            break;
+        }
+
+        onFileDone(render(inputs[index]));
+    }
+
+    return jobHasFinished;
+}
+
+RenderResult RenderWorker::render(const RenderInput& input)
+{
+    RenderResult result;
+    result.input = input;
+
+    std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(input.file));
+    if (reader == nullptr)
+    {
+        result.error = "not a readable audio file";
+        return result;
+    }
+
+    const auto numChannels = (int)reader->numChannels;
+    const auto sampleRate = reader->sampleRate;
+
+    // the processor runs mono or stereo, in and out the same
+    auto channelSet = juce::AudioChannelSet::canonicalChannelSet(numChannels);
+
+    juce::AudioProcessor::BusesLayout layout;
+    layout.inputBuses.add(channelSet);
+    layout.outputBuses.add(channelSet);
+
+    if (numChannels > 2 || !processor.setBusesLayout(layout))
+    {
+        result.error = juce::String(numChannels) + " channels are not supported";
+        return result;
+    }
+
+    auto* format = formats.findFormatForFileExtension(input.file.getFileExtension());
+    auto output = settings.outputDirectory.getChildFile(input.relativePath);
+
+    // truncating the output would destroy the input before it is read
+    if (output == input.file || output.getLinkedTarget() == input.file.getLinkedTarget())
+    {
+        result.error = "the output would overwrite the input";
+        return result;
+    }
+
+    if (!output.getParentDirectory().createDirectory())
+    {
+        result.error = "cannot create " + output.getParentDirectory().getFullPathName();
+        return result;
+    }
+
+    std::unique_ptr<juce::FileOutputStream> stream(output.createOutputStream());
+    std::unique_ptr<juce::AudioFormatWriter> writer;
+
+    // nothing is left behind when a file can't be rendered to the end
+    auto fail = [&](const juce::String& error)
+    {
+        writer.reset();
+        stream.reset();
+        output.deleteFile();
+
+        result.error = error;
+        return result;
+    };
+
+    if (format == nullptr || stream == nullptr || !stream->setPosition(0) || !stream->truncate().wasOk())
+    {
+        return fail("cannot write " + output.getFullPathName());
+    }
+
+    writer.reset(format->createWriterFor(stream.get(),
+                                         sampleRate,
+                                         (unsigned int)numChannels,
+                                         (int)reader->bitsPerSample,
+                                         reader->metadataValues,
+                                         0));
+    if (writer == nullptr)
+    {
+        return fail("cannot write " + output.getFullPathName());
+    }
+
+    // the writer owns the stream now
+    stream.release();
+
+    // every file starts from the same settings and a clean processor: prepareToPlay clears
+    // the filter and envelope states and starts the gains on their targets, without a ramp
+    processor.parameters.writeValues(settings.values);
+    processor.prepareToPlay(sampleRate, settings.blockSize);
+
+    juce::AudioBuffer<float> buffer(numChannels, settings.blockSize);
+    juce::MidiBuffer midi;
+
+    auto start = juce::Time::getHighResolutionTicks();
+
+    for (juce::int64 position = 0; position < reader->lengthInSamples; position += settings.blockSize)
+    {
+        auto numSamples = (int)juce::jmin((juce::int64)settings.blockSize, reader->lengthInSamples - position);
+
+        // the last block is shorter, without giving the memory back
+        buffer.setSize(numChannels, numSamples, false, false, true);
+
+        if (!reader->read(&buffer, 0, numSamples, position, true, true))
+        {
+            processor.releaseResources();
+            return fail("read failed on " + input.file.getFullPathName());
+        }
+
+        processor.processBlock(buffer, midi);
+
+        if (!writer->writeFromAudioSampleBuffer(buffer, 0, numSamples))
+        {
+            processor.releaseResources();
+            return fail("write failed on " + output.getFullPathName());
+        }
+    }
+
+    processor.releaseResources();
+
+    // the header is only complete once the writer is closed
+    writer.reset();
+
+    result.renderSeconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+    result.audioSeconds = (double)reader->lengthInSamples / sampleRate;
+    result.succeeded = true;
+
+    return result;
+}
@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    BatchRenderer.h
+    Created: 21 Oct 2026 2:37:50pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "../../../Source/PluginProcessor.h"
+
+//==============================================================================
+/**
+ what every file of a batch gets rendered with.
+*/
+struct RenderSettings
+{
+    // from a state file or a preset, see Main.cpp
+    Params::Values values{};
+
+    juce::File outputDirectory;
+    int blockSize = 8192;
+};
+
+/*
+ a file to render, and where its output goes under the output directory.
+ */
+struct RenderInput
+{
+    juce::File file;
+    // the same as the input's path below the directory it was found in
+    juce::String relativePath;
+};
+
+/*
+ what one file took, for the report.
+ */
+struct RenderResult
+{
+    RenderInput input;
+    bool succeeded = false;
+    juce::String error;
+    double audioSeconds = 0.0;
+    double renderSeconds = 0.0;
+};
+
+//==============================================================================
+/**
+ one worker of the batch: owns a processor and renders files through it, one after
+ another, until the shared queue runs dry. the files are streamed block by block,
+ so memory stays the same whatever their length.
+*/
+struct RenderWorker : juce::ThreadPoolJob
+{
+    RenderWorker(const RenderSettings& settings,
+                 const juce::Array<RenderInput>& inputs,
+                 std::atomic<int>& nextInput,
+                 std::function<void(const RenderResult&)> onFileDone);
+
+    JobStatus runJob() override;
+private:
+    RenderResult render(const RenderInput& input);
+
+    const RenderSettings& settings;
+    const juce::Array<RenderInput>& inputs;
+    std::atomic<int>& nextInput;
+    std::function<void(const RenderResult&)> onFileDone;
+
+    juce::AudioFormatManager formats;
+    SimpleMBCompAudioProcessor processor;
+};
@@ -0,0 +1,292 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 21 Oct 2026 2:37:50pm
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "BatchRenderer.h"
+#include "../../../Source/DSP/PresetBank.h"
+
+//==============================================================================
+static void printUsage()
+{
+    std::cout << "usage: BatchRenderer (--state <file> | --preset <name or number> [--bank <file>])\n"
+                 "                     --output <directory> [--block <samples>] [--threads <count>] [--verify]\n"
+                 "                     <audio files or directories>...\n"
+                 "\n"
+                 "renders WAV and AIFF files through SimpleMBComp with fixed settings.\n"
+                 "--state takes a state as the plugin saves it, --preset a preset of the bank,\n"
+                 "by name or by number, counting from 1. files found in a directory keep their\n"
+                 "path below it under --output. --verify renders every file a second time, on one\n"
+                 "thread and in another order, and fails unless both renders are identical.\n"
+              << std::endl;
+}
+
+/*
+ the settings to render with, from --state or --preset. false, with a message, if there are none.
+ */
+static bool loadValues(const juce::ArgumentList& args, Params::Values& values)
+{
+    // a throwaway instance reads both state formats, and gives the values back
+    SimpleMBCompAudioProcessor processor;
+
+    if (args.containsOption("--state"))
+    {
+        auto file = args.getFileForOption("--state");
+
+        juce::MemoryBlock state;
+        if (!file.loadFileAsData(state))
+        {
+            std::cout << "cannot read " << file.getFullPathName() << std::endl;
+            return false;
+        }
+
+        processor.setStateInformation(state.getData(), (int)state.getSize());
+        processor.parameters.readValues(values);
+
+        return true;
+    }
+
+    if (args.containsOption("--preset"))
+    {
+        auto bankFile = args.containsOption("--bank") ? args.getFileForOption("--bank") :
+                                                        PresetBank::getDefaultFile();
+
+        PresetBank bank;
+        if (!bank.open(bankFile))
+        {
+            std::cout << "cannot open the preset bank " << bankFile.getFullPathName() << std::endl;
+            return false;
+        }
+
+        auto preset = args.getValueForOption("--preset");
+        auto index = preset.containsOnly("0123456789") ? preset.getIntValue() - 1 : -1;
+
+        for (int i = 0; index < 0 && i < bank.getNumPresets(); ++i)
+        {
+            if (bank.getName(i) == preset)
+            {
+                index = i;
+            }
+        }
+
+        if (!bank.decode(index, values))
+        {
+            std::cout << "no preset " << preset << " in " << bankFile.getFullPathName() << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    printUsage();
+    return false;
+}
+
+/*
+ the files named on the command line, and the audio files anywhere below the directories,
+ except those in 'outputDirectory': a second run must not render the first one's outputs.
+ */
+static juce::Array<RenderInput> findInputs(const juce::ArgumentList& args, const juce::File& outputDirectory)
+{
+    const juce::StringArray optionsWithValue{ "--state", "--preset", "--bank", "--output", "--block", "--threads" };
+    const auto patterns = "*.wav;*.aif;*.aiff";
+
+    juce::Array<RenderInput> inputs;
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        auto& arg = args[i];
+
+        if (arg.isOption())
+        {
+            // skip the value too
+            i += optionsWithValue.contains(arg.text) ? 1 : 0;
+            continue;
+        }
+
+        auto file = arg.resolveAsFile();
+
+        if (file.isDirectory())
+        {
+            for (const auto& child : file.findChildFiles(juce::File::findFiles, true, patterns))
+            {
+                if (!child.isAChildOf(outputDirectory))
+                {
+                    inputs.add({ child, child.getRelativePathFrom(file) });
+                }
+            }
+        }
+        else if (file.existsAsFile())
+        {
+            inputs.add({ file, file.getFileName() });
+        }
+        else
+        {
+            std::cout << "skipping " << arg.text << ": no such file" << std::endl;
+        }
+    }
+
+    return inputs;
+}
+
+/*
+ renders 'inputs' again on this thread, into a temporary directory, and compares them
+ with the batch's outputs. a worker renders many files with one processor, and which
+ ones depends on the scheduling: whatever a file inherits from the one before shows here.
+ returns the number of files that differ.
+ */
+static int verifyRenders(const RenderSettings& settings, const juce::Array<RenderInput>& inputs)
+{
+    auto verifySettings = settings;
+    verifySettings.outputDirectory = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                                         .getNonexistentChildFile("BatchRendererVerify", {}, false);
+
+    if (!verifySettings.outputDirectory.createDirectory())
+    {
+        std::cout << "cannot create " << verifySettings.outputDirectory.getFullPathName() << std::endl;
+        return inputs.size();
+    }
+
+    // last file first, so each one follows another file than it did in the batch
+    juce::Array<RenderInput> reversed;
+    for (int i = inputs.size(); --i >= 0;)
+    {
+        reversed.add(inputs[i]);
+    }
+
+    int numDifferent = 0;
+    std::atomic<int> nextInput{ 0 };
+
+    RenderWorker worker(verifySettings, reversed, nextInput, [&](const RenderResult& result)
+    {
+        auto first = settings.outputDirectory.getChildFile(result.input.relativePath);
+        auto second = verifySettings.outputDirectory.getChildFile(result.input.relativePath);
+
+        if (!result.succeeded || !first.hasIdenticalContentTo(second))
+        {
+            ++numDifferent;
+            std::cout << result.input.relativePath.paddedRight(' ', 40) << " differs on a second render" << std::endl;
+        }
+    });
+
+    worker.runJob();
+    verifySettings.outputDirectory.deleteRecursively();
+
+    return numDifferent;
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h") || !args.containsOption("--output"))
+    {
+        printUsage();
+        return 1;
+    }
+
+    RenderSettings settings;
+
+    if (!loadValues(args, settings.values))
+    {
+        return 1;
+    }
+
+    settings.outputDirectory = args.getFileForOption("--output");
+    if (!settings.outputDirectory.createDirectory())
+    {
+        std::cout << "cannot create " << settings.outputDirectory.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    if (args.containsOption("--block"))
+    {
+        settings.blockSize = juce::jlimit(32, 1 << 16, args.getValueForOption("--block").getIntValue());
+    }
+
+    auto inputs = findInputs(args, settings.outputDirectory);
+    if (inputs.isEmpty())
+    {
+        std::cout << "nothing to render" << std::endl;
+        return 1;
+    }
+
+    auto numThreads = juce::SystemStats::getNumCpus();
+    if (args.containsOption("--threads"))
+    {
+        numThreads = juce::jmax(1, args.getValueForOption("--threads").getIntValue());
+    }
+
+    numThreads = juce::jmin(numThreads, inputs.size());
+
+    std::atomic<int> nextInput{ 0 };
+    juce::CriticalSection reportLock;
+    double totalAudioSeconds = 0.0;
+    int numFailed = 0;
+
+    auto report = [&](const RenderResult& result)
+    {
+        const juce::ScopedLock sl(reportLock);
+
+        if (result.succeeded)
+        {
+            totalAudioSeconds += result.audioSeconds;
+
+            std::cout << result.input.relativePath.paddedRight(' ', 40)
+                      << juce::String(result.audioSeconds, 1).paddedLeft(' ', 10) << " s"
+                      << juce::String(result.audioSeconds / result.renderSeconds, 1).paddedLeft(' ', 10) << "x realtime"
+                      << std::endl;
+        }
+        else
+        {
+            ++numFailed;
+            std::cout << result.input.relativePath.paddedRight(' ', 40) << " failed: " << result.error << std::endl;
+        }
+    };
+
+    // one worker per thread, each with its own processor, built here before anything runs
+    juce::ThreadPool pool(numThreads);
+    std::vector<std::unique_ptr<RenderWorker>> workers;
+
+    for (int i = 0; i < numThreads; ++i)
+    {
+        workers.push_back(std::make_unique<RenderWorker>(settings, inputs, nextInput, report));
+    }
+
+    auto start = juce::Time::getHighResolutionTicks();
+
+    for (auto& worker : workers)
+    {
+        pool.addJob(worker.get(), false);
+    }
+
+    for (auto& worker : workers)
+    {
+        pool.waitForJobToFinish(worker.get(), -1);
+    }
+
+    auto elapsed = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+
+    std::cout << "\n" << inputs.size() - numFailed << " files, " << juce::String(totalAudioSeconds, 1) << " s of audio in "
+              << juce::String(elapsed, 1) << " s on " << numThreads << " threads: "
+              << juce::String(totalAudioSeconds / elapsed, 1) << "x realtime" << std::endl;
+
+    if (numFailed == 0 && args.containsOption("--verify"))
+    {
+        auto numDifferent = verifyRenders(settings, inputs);
+        std::cout << (numDifferent == 0 ? "every render is reproducible" : "renders are not reproducible") << std::endl;
+
+        numFailed += numDifferent;
+    }
+
+    return numFailed == 0 ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 24 Oct 2026 10:22:48am
+    Author:  erwan
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../../Source/PluginProcessor.h"
+#include "../../../Source/DSP/FactoryPresets.h"
+#include "../../../Source/DSP/StateFormat.h"
+
+//==============================================================================
+static void printUsage()
+{
+    std::cout << "usage: PresetBankBuilder --output <file> [--factory] [<state files or directories>...]\n"
+                 "\n"
+                 "writes a preset bank for SimpleMBComp. --factory puts the factory presets first,\n"
+                 "then come the states, each named after its file, the files of a directory in\n"
+                 "name order. a state is a file as the plugin saves it, in either format. with\n"
+                 "--output " << PresetBank::getDefaultFile().getFullPathName() << "\n"
+                 "the plugin offers the bank as its programs.\n"
+              << std::endl;
+}
+
+/*
+ the files named on the command line, and the files directly in the directories.
+ */
+static juce::Array<juce::File> findStates(const juce::ArgumentList& args)
+{
+    juce::Array<juce::File> files;
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        auto& arg = args[i];
+
+        if (arg.isOption())
+        {
+            // skip the value too
+            i += arg.text == "--output" ? 1 : 0;
+            continue;
+        }
+
+        auto file = arg.resolveAsFile();
+
+        if (file.isDirectory())
+        {
+            auto children = file.findChildFiles(juce::File::findFiles, false);
+            children.sort();
+            files.addArray(children);
+        }
+        else if (file.existsAsFile())
+        {
+            files.add(file);
+        }
+        else
+        {
+            std::cout << "skipping " << arg.text << ": no such file" << std::endl;
+        }
+    }
+
+    return files;
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h") || !args.containsOption("--output"))
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<PresetBank::Preset> presets;
+
+    if (args.containsOption("--factory"))
+    {
+        presets = FactoryPresets::create();
+    }
+
+    // a throwaway instance reads the ValueTree states older versions saved
+    SimpleMBCompAudioProcessor processor;
+    int numFailed = 0;
+
+    for (const auto& file : findStates(args))
+    {
+        juce::MemoryBlock state;
+        if (!file.loadFileAsData(state))
+        {
+            ++numFailed;
+            std::cout << file.getFileName().paddedRight(' ', 40) << " cannot be read" << std::endl;
+            continue;
+        }
+
+        Params::Values values;
+
+        if (!StateFormat::decode(state.getData(), (int)state.getSize(), values))
+        {
+            if (!juce::ValueTree::readFromData(state.getData(), state.getSize()).isValid())
+            {
+                ++numFailed;
+                std::cout << file.getFileName().paddedRight(' ', 40) << " is not a state" << std::endl;
+                continue;
+            }
+
+            // saved before the binary format, the processor converts it
+            processor.setStateInformation(state.getData(), (int)state.getSize());
+            processor.parameters.readValues(values);
+        }
+
+        PresetBank::Preset preset{ file.getFileNameWithoutExtension(), {} };
+        StateFormat::write(values, preset.state);
+
+        presets.push_back(std::move(preset));
+    }
+
+    if (presets.empty())
+    {
+        std::cout << "no presets to write" << std::endl;
+        return 1;
+    }
+
+    auto output = args.getFileForOption("--output");
+
+    if (!output.getParentDirectory().createDirectory() || !PresetBank::write(output, presets))
+    {
+        std::cout << "cannot write " << output.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    std::cout << presets.size() << " presets written to " << output.getFullPathName() << std::endl;
+
+    return numFailed == 0 ? 0 : 1;
+}